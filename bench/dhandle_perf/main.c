@@ -0,0 +1,313 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Test case description: create many tables, then have a set of threads find the tables' data
+ * handles in the connection. There are three phases:
+ *
+ * 1. Each thread repeatedly opens a new session, opens a cursor on a random table, reads a record
+ * and closes the session again. Every cursor open misses the new session's data handle cache, the
+ * pattern of applications with many short-lived sessions touching many collections.
+ *
+ * 2. Each thread repeatedly looks up a random table's data handle holding the handle list lock, the
+ * way every connection lookup used to be done.
+ *
+ * 3. As phase 2, but with the lock-free lookup.
+ *
+ * The number of tables is set with -n, the number of threads with -T and the number of cursor
+ * opens per thread with -o. With -S, the sweep server is configured to close and discard idle
+ * handles as aggressively as it can while the lookups run, which exercises handle removal racing
+ * with lock-free lookups.
+ */
+
+#define SHARED_PARSE_OPTIONS "h:n:o:pT:v"
+
+#define LOOKUP_MULT 10 /* Handle lookups per cursor open */
+#define N_OPS (20 * WT_THOUSAND)
+#define N_TABLES (10 * WT_THOUSAND)
+#define N_THREADS 8
+
+#define CONN_CONFIG "create,cache_size=1G,session_max=1000,statistics=(fast)"
+/* Aggressive sweep divides the scan interval by 10, sweep every second. */
+#define CONN_CONFIG_SWEEP                                      \
+    ",file_manager=(close_handle_minimum=0,close_idle_time=1," \
+    "close_scan_interval=10),timing_stress_for_test=[aggressive_sweep]"
+
+typedef enum { LOOKUP_SESSION, LOOKUP_LOCKED, LOOKUP_NOLOCK } LOOKUP_MODE;
+
+typedef struct {
+    TEST_OPTS *testopts;
+    LOOKUP_MODE mode;
+    uint64_t found;
+} THREAD_ARGS;
+
+static TEST_OPTS *opts, _opts;
+
+extern int __wt_optind;
+
+static void create_perf_json(double, double, double);
+static int64_t get_stat(WT_SESSION *, int);
+static double run_phase(LOOKUP_MODE, const char *);
+static void *thread_lookup(void *);
+static void usage(void) WT_GCC_FUNC_DECL_ATTRIBUTE((noreturn));
+
+/*
+ * usage --
+ *     Print usage help for the program.
+ */
+static void
+usage(void)
+{
+    fprintf(stderr, "usage: %s%s [-S]\n\n", opts->progname, opts->usage);
+    fprintf(stderr, "Test-specific options:\n");
+    fprintf(stderr, "    -S    sweep idle handles aggressively while looking them up\n");
+    exit(EXIT_FAILURE);
+}
+
+/*
+ * main --
+ *     Create the tables, run the lookup phases and report the rate of data handle lookups.
+ */
+int
+main(int argc, char *argv[])
+{
+    WT_CURSOR *cursor;
+    WT_SESSION *session;
+    uint64_t i;
+    double locked_rate, nolock_rate, session_rate;
+    int ch;
+    char config[256], uri[64];
+    bool aggressive_sweep;
+
+    opts = &_opts;
+    memset(opts, 0, sizeof(*opts));
+    opts->nrecords = N_TABLES;
+    opts->nops = N_OPS;
+    opts->nthreads = N_THREADS;
+    aggressive_sweep = false;
+
+    testutil_parse_begin_opt(argc, argv, SHARED_PARSE_OPTIONS, opts);
+    while ((ch = __wt_getopt(opts->progname, argc, argv, "S" SHARED_PARSE_OPTIONS)) != EOF)
+        switch (ch) {
+        case 'S':
+            aggressive_sweep = true;
+            break;
+        default:
+            if (testutil_parse_single_opt(opts, ch) != 0)
+                usage();
+        }
+    argc -= __wt_optind;
+    if (argc != 0)
+        usage();
+    testutil_parse_end_opt(opts);
+
+    testutil_recreate_dir(opts->home);
+    testutil_progress(opts, "start");
+
+    testutil_snprintf(
+      config, sizeof(config), "%s%s", CONN_CONFIG, aggressive_sweep ? CONN_CONFIG_SWEEP : "");
+    testutil_check(wiredtiger_open(opts->home, NULL, config, &opts->conn));
+    testutil_check(opts->conn->open_session(opts->conn, NULL, NULL, &session));
+
+    /* Create the tables, each with a single record. */
+    for (i = 0; i < opts->nrecords; ++i) {
+        testutil_snprintf(uri, sizeof(uri), "table:dhandle_perf%" PRIu64, i);
+        testutil_check(session->create(session, uri, "key_format=Q,value_format=Q"));
+        testutil_check(session->open_cursor(session, uri, NULL, NULL, &cursor));
+        cursor->set_key(cursor, i);
+        cursor->set_value(cursor, i);
+        testutil_check(cursor->insert(cursor));
+        testutil_check(cursor->close(cursor));
+    }
+    testutil_progress(opts, "tables created");
+
+    session_rate = run_phase(LOOKUP_SESSION, "new-session cursor opens");
+    locked_rate = run_phase(LOOKUP_LOCKED, "handle lookups with the handle list lock");
+    nolock_rate = run_phase(LOOKUP_NOLOCK, "lock-free handle lookups");
+    printf("lock-free lookups ran %.2fx the rate of locked lookups\n", nolock_rate / locked_rate);
+    printf("data handles found without the handle list lock: %" PRId64 "\n",
+      get_stat(session, WT_STAT_CONN_DH_CONN_FIND_NOLOCK));
+    printf("data handles removed by the sweep server: %" PRId64 "\n",
+      get_stat(session, WT_STAT_CONN_DH_SWEEP_REMOVE));
+
+    create_perf_json(session_rate, locked_rate, nolock_rate);
+
+    testutil_check(session->close(session, NULL));
+    testutil_cleanup(opts);
+    return (0);
+}
+
+/*
+ * run_phase --
+ *     Run the lookup threads in one mode and return the rate of operations per second.
+ */
+static double
+run_phase(LOOKUP_MODE mode, const char *name)
+{
+    struct timespec start, stop;
+    THREAD_ARGS *args;
+    pthread_t *tids;
+    uint64_t found, i, elapsed_ms, ops;
+    double rate;
+
+    args = dcalloc((size_t)opts->nthreads, sizeof(*args));
+    tids = dcalloc((size_t)opts->nthreads, sizeof(*tids));
+
+    __wt_epoch(NULL, &start);
+    for (i = 0; i < opts->nthreads; ++i) {
+        args[i].testopts = opts;
+        args[i].mode = mode;
+        testutil_check(pthread_create(&tids[i], NULL, thread_lookup, &args[i]));
+    }
+    for (found = 0, i = 0; i < opts->nthreads; ++i) {
+        testutil_check(pthread_join(tids[i], NULL));
+        found += args[i].found;
+    }
+    __wt_epoch(NULL, &stop);
+    testutil_progress(opts, name);
+
+    ops = opts->nthreads * opts->nops * (mode == LOOKUP_SESSION ? 1 : LOOKUP_MULT);
+    elapsed_ms = WT_MAX(WT_TIMEDIFF_MS(stop, start), 1);
+    rate = (double)ops / ((double)elapsed_ms / WT_THOUSAND);
+    printf("%" PRIu64 " tables, %" PRIu64 " threads: %" PRIu64 " %s (%" PRIu64
+           " found) in %" PRIu64 "ms, %.0f per second\n",
+      opts->nrecords, opts->nthreads, ops, name, found, elapsed_ms, rate);
+
+    free(args);
+    free(tids);
+    return (rate);
+}
+
+/*
+ * thread_lookup --
+ *     Repeatedly find the data handle of a random table.
+ */
+static void *
+thread_lookup(void *arg)
+{
+    THREAD_ARGS *args;
+    WT_CONNECTION *conn;
+    WT_CURSOR *cursor;
+    WT_RAND_STATE rnd;
+    WT_SESSION *session;
+    WT_SESSION_IMPL *session_impl;
+    uint64_t i, nops, table, value;
+    int ret;
+    char uri[64];
+
+    args = (THREAD_ARGS *)arg;
+    conn = args->testopts->conn;
+    nops = args->testopts->nops;
+    session = NULL;
+    session_impl = NULL;
+
+    __wt_random_init_seed(NULL, &rnd);
+    if (args->mode != LOOKUP_SESSION) {
+        testutil_check(conn->open_session(conn, NULL, NULL, &session));
+        session_impl = (WT_SESSION_IMPL *)session;
+        nops *= LOOKUP_MULT;
+    }
+
+    for (i = 0; i < nops; ++i) {
+        ret = 0;
+        table = __wt_random(&rnd) % args->testopts->nrecords;
+        testutil_snprintf(uri, sizeof(uri), "table:dhandle_perf%" PRIu64, table);
+
+        switch (args->mode) {
+        case LOOKUP_SESSION:
+            testutil_check(conn->open_session(conn, NULL, NULL, &session));
+            testutil_check(session->open_cursor(session, uri, NULL, NULL, &cursor));
+            cursor->set_key(cursor, table);
+            testutil_check(cursor->search(cursor));
+            testutil_check(cursor->get_value(cursor, &value));
+            testutil_assert(value == table);
+            testutil_check(session->close(session, NULL));
+            ++args->found;
+            continue;
+        case LOOKUP_LOCKED:
+            WT_WITH_HANDLE_LIST_READ_LOCK(session_impl,
+              if ((ret = __wt_conn_dhandle_find(session_impl, uri, NULL)) == 0)
+                WT_DHANDLE_ACQUIRE(session_impl->dhandle));
+            break;
+        case LOOKUP_NOLOCK:
+            ret = __wt_conn_dhandle_find_nolock(session_impl, uri, NULL);
+            break;
+        }
+
+        /* A swept handle isn't found, otherwise give back the reference the lookup acquired. */
+        if (ret == WT_NOTFOUND)
+            continue;
+        testutil_check(ret);
+        WT_DHANDLE_RELEASE(session_impl->dhandle);
+        session_impl->dhandle = NULL;
+        ++args->found;
+    }
+
+    if (session_impl != NULL)
+        testutil_check(session->close(session, NULL));
+    return (NULL);
+}
+
+/*
+ * get_stat --
+ *     Return a connection statistic.
+ */
+static int64_t
+get_stat(WT_SESSION *session, int stat)
+{
+    WT_CURSOR *cursor;
+    int64_t value;
+    const char *desc, *pvalue;
+
+    testutil_check(session->open_cursor(session, "statistics:", NULL, NULL, &cursor));
+    cursor->set_key(cursor, stat);
+    testutil_check(cursor->search(cursor));
+    testutil_check(cursor->get_value(cursor, &desc, &pvalue, &value));
+    testutil_check(cursor->close(cursor));
+    return (value);
+}
+
+/*
+ * create_perf_json --
+ *     Construct the performance json which is used to generate the performance charts.
+ */
+static void
+create_perf_json(double session_rate, double locked_rate, double nolock_rate)
+{
+    FILE *fp;
+
+    testutil_assert_errno((fp = fopen("dhandle_perf.json", "w")) != NULL);
+    testutil_assert(fprintf(fp,
+                      "[{\"info\":{\"test_name\": \"dhandle_perf\"},"
+                      "\"metrics\": [{\"name\":\"Cursor opens per second\",\"value\":%.0f}, "
+                      "{\"name\":\"Locked lookups per second\",\"value\":%.0f}, "
+                      "{\"name\":\"Lock-free lookups per second\",\"value\":%.0f}]}]",
+                      session_rate, locked_rate, nolock_rate) > 0);
+    testutil_assert(fclose(fp) == 0);
+}
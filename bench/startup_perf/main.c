@@ -0,0 +1,232 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Test case description: measure how long it takes to open a database with many tables. The tables
+ * are created in rounds, growing to the number set with -n. After each round the connection is
+ * closed and reopened, reading the metadata at startup once on a single thread and once with the
+ * number of threads set with -T (the rollback to stable thread count, which sizes the startup
+ * metadata read). Each open is followed by a first access to every table.
+ */
+
+#define SHARED_PARSE_OPTIONS "h:n:pT:v"
+
+#define N_ROUNDS 3
+#define N_TABLES (10 * WT_THOUSAND)
+#define N_THREADS 4
+
+#define CONN_CONFIG "create,cache_size=1G,log=(enabled),statistics=(fast)"
+
+typedef struct {
+    uint64_t open_ms;   /* Time to open the connection */
+    uint64_t access_ms; /* Time to first access every table */
+    int64_t cache_entries, cache_hits, preload_skipped;
+} STARTUP_RESULT;
+
+static TEST_OPTS *opts, _opts;
+
+extern int __wt_optind;
+
+static void create_perf_json(STARTUP_RESULT *, STARTUP_RESULT *);
+static void create_tables(uint64_t, uint64_t);
+static int64_t get_stat(WT_SESSION *, int);
+static void run_startup(uint64_t, uint64_t, STARTUP_RESULT *);
+static void usage(void) WT_GCC_FUNC_DECL_ATTRIBUTE((noreturn));
+
+/*
+ * usage --
+ *     Print usage help for the program.
+ */
+static void
+usage(void)
+{
+    fprintf(stderr, "usage: %s%s\n", opts->progname, opts->usage);
+    exit(EXIT_FAILURE);
+}
+
+/*
+ * main --
+ *     Create the tables in rounds and report the time to open the database after each round.
+ */
+int
+main(int argc, char *argv[])
+{
+    STARTUP_RESULT parallel, single;
+    uint64_t ntables, round, tables;
+    int ch;
+
+    opts = &_opts;
+    memset(opts, 0, sizeof(*opts));
+    opts->nrecords = N_TABLES;
+    opts->nthreads = N_THREADS;
+
+    testutil_parse_begin_opt(argc, argv, SHARED_PARSE_OPTIONS, opts);
+    while ((ch = __wt_getopt(opts->progname, argc, argv, SHARED_PARSE_OPTIONS)) != EOF)
+        if (testutil_parse_single_opt(opts, ch) != 0)
+            usage();
+    argc -= __wt_optind;
+    if (argc != 0)
+        usage();
+    testutil_parse_end_opt(opts);
+
+    testutil_recreate_dir(opts->home);
+    testutil_progress(opts, "start");
+
+    for (tables = 0, round = 1; round <= N_ROUNDS; ++round) {
+        ntables = opts->nrecords * round / N_ROUNDS;
+        create_tables(tables, ntables);
+        tables = ntables;
+
+        run_startup(tables, 0, &single);
+        run_startup(tables, opts->nthreads, &parallel);
+        printf("%" PRIu64 " tables: open with %" PRIu64 " threads ran %.2fx the speed of 1 thread\n",
+          tables, opts->nthreads, (double)WT_MAX(single.open_ms, 1) / WT_MAX(parallel.open_ms, 1));
+    }
+
+    create_perf_json(&single, &parallel);
+
+    testutil_cleanup(opts);
+    return (0);
+}
+
+/*
+ * create_tables --
+ *     Open the database and create tables to bring the total from the first count to the second,
+ *     each with a single record.
+ */
+static void
+create_tables(uint64_t first, uint64_t last)
+{
+    WT_CONNECTION *conn;
+    WT_CURSOR *cursor;
+    WT_SESSION *session;
+    uint64_t i;
+    char uri[64];
+
+    testutil_check(wiredtiger_open(opts->home, NULL, CONN_CONFIG, &conn));
+    testutil_check(conn->open_session(conn, NULL, NULL, &session));
+    for (i = first; i < last; ++i) {
+        testutil_snprintf(uri, sizeof(uri), "table:startup_perf%" PRIu64, i);
+        testutil_check(session->create(session, uri, "key_format=Q,value_format=Q"));
+        testutil_check(session->open_cursor(session, uri, NULL, NULL, &cursor));
+        cursor->set_key(cursor, i);
+        cursor->set_value(cursor, i);
+        testutil_check(cursor->insert(cursor));
+        testutil_check(cursor->close(cursor));
+    }
+    testutil_check(conn->close(conn, NULL));
+    testutil_progress(opts, "tables created");
+}
+
+/*
+ * run_startup --
+ *     Open the database reading the metadata with the given number of threads, then read a record
+ *     from every table.
+ */
+static void
+run_startup(uint64_t tables, uint64_t threads, STARTUP_RESULT *result)
+{
+    struct timespec start, opened, stop;
+    WT_CONNECTION *conn;
+    WT_CURSOR *cursor;
+    WT_SESSION *session;
+    uint64_t i, value;
+    char config[256], uri[64];
+
+    testutil_snprintf(
+      config, sizeof(config), "%s,rollback_to_stable=(threads=%" PRIu64 ")", CONN_CONFIG, threads);
+
+    __wt_epoch(NULL, &start);
+    testutil_check(wiredtiger_open(opts->home, NULL, config, &conn));
+    __wt_epoch(NULL, &opened);
+    testutil_check(conn->open_session(conn, NULL, NULL, &session));
+    for (i = 0; i < tables; ++i) {
+        testutil_snprintf(uri, sizeof(uri), "table:startup_perf%" PRIu64, i);
+        testutil_check(session->open_cursor(session, uri, NULL, NULL, &cursor));
+        cursor->set_key(cursor, i);
+        testutil_check(cursor->search(cursor));
+        testutil_check(cursor->get_value(cursor, &value));
+        testutil_assert(value == i);
+        testutil_check(cursor->close(cursor));
+    }
+    __wt_epoch(NULL, &stop);
+
+    result->open_ms = WT_TIMEDIFF_MS(opened, start);
+    result->access_ms = WT_TIMEDIFF_MS(stop, opened);
+    result->cache_entries = get_stat(session, WT_STAT_CONN_META_CKPT_CACHE_ENTRIES);
+    result->cache_hits = get_stat(session, WT_STAT_CONN_META_CKPT_CACHE_HIT);
+    result->preload_skipped = get_stat(session, WT_STAT_CONN_BLOCK_PRELOAD_SKIPPED);
+    testutil_check(conn->close(conn, NULL));
+    testutil_progress(opts, "startup");
+
+    printf("%" PRIu64 " tables, %" PRIu64 " threads: open %" PRIu64 "ms, first access %" PRIu64
+           "ms, metadata entries cached %" PRId64 ", cache hits %" PRId64
+           ", preloads skipped %" PRId64 "\n",
+      tables, WT_MAX(threads, 1), result->open_ms, result->access_ms, result->cache_entries,
+      result->cache_hits, result->preload_skipped);
+}
+
+/*
+ * get_stat --
+ *     Return a connection statistic.
+ */
+static int64_t
+get_stat(WT_SESSION *session, int stat)
+{
+    WT_CURSOR *cursor;
+    int64_t value;
+    const char *desc, *pvalue;
+
+    testutil_check(session->open_cursor(session, "statistics:", NULL, NULL, &cursor));
+    cursor->set_key(cursor, stat);
+    testutil_check(cursor->search(cursor));
+    testutil_check(cursor->get_value(cursor, &desc, &pvalue, &value));
+    testutil_check(cursor->close(cursor));
+    return (value);
+}
+
+/*
+ * create_perf_json --
+ *     Construct the performance json which is used to generate the performance charts.
+ */
+static void
+create_perf_json(STARTUP_RESULT *single, STARTUP_RESULT *parallel)
+{
+    FILE *fp;
+
+    testutil_assert_errno((fp = fopen("startup_perf.json", "w")) != NULL);
+    testutil_assert(fprintf(fp,
+                      "[{\"info\":{\"test_name\": \"startup_perf\"},"
+                      "\"metrics\": [{\"name\":\"Single-threaded open ms\",\"value\":%" PRIu64
+                      "}, "
+                      "{\"name\":\"Multi-threaded open ms\",\"value\":%" PRIu64 "}, "
+                      "{\"name\":\"First access ms\",\"value\":%" PRIu64 "}]}]",
+                      single->open_ms, parallel->open_ms, parallel->access_ms) > 0);
+    testutil_assert(fclose(fp) == 0);
+}
@@ -1229,6 +1229,15 @@ wiredtiger_open_common =\
         open connection in read-only mode. The database must exist. All methods that may
         modify a database are disabled. See @ref readonly for more information''',
         type='boolean'),
+    Config('reconcile', '', r'''
+        reconciliation configuration options''',
+        type='category', subconfig=[
+        Config('write_threads', '0', r'''
+            the number of threads that compress, checksum and write the blocks of pages eviction
+            splits into multiple blocks, while the evicting thread builds the remaining blocks of
+            the page. When zero, the evicting thread writes each block itself''',
+            min='0', max='20'),
+        ]),
     Config('salvage', 'false', r'''
         open connection and salvage any WiredTiger-owned database and log files that it detects as
         corrupted. This call should only be used after getting an error return of WT_TRY_SALVAGE.
@@ -1468,6 +1477,12 @@ methods = {
         records in the bitmap (as specified by the object's \c value_format configuration).
         Bulk-loaded bitmap values must end on a byte boundary relative to the bit count (except
         for the last set of values loaded)'''),
+    Config('bulk_threads', '0', r'''
+        the number of internal threads used to build leaf pages when bulk-loading a row-store
+        object. Inserted rows are gathered into sorted runs that are reconciled into leaf pages
+        in parallel, and the runs are stitched together under newly built internal pages when the
+        cursor is closed. The default of zero builds the leaf pages in the application thread''',
+        min='0', max='32'),
     Config('checkpoint', '', r'''
         the name of a checkpoint to open. (The reserved name "WiredTigerCheckpoint" opens
         the most recent checkpoint taken for the object.) The cursor does not support data
@@ -176,6 +176,8 @@ conn_stats = [
     ConnStat('memory_allocation', 'memory allocations'),
     ConnStat('memory_free', 'memory frees'),
     ConnStat('memory_grow', 'memory re-allocations'),
+    ConnStat('meta_ckpt_cache_entries', 'metadata entries read into the startup checkpoint cache'),
+    ConnStat('meta_ckpt_cache_hit', 'metadata checkpoint lookups served from the startup checkpoint cache'),
     ConnStat('no_session_sweep_5min', 'number of sessions without a sweep for 5+ minutes'),
     ConnStat('no_session_sweep_60min', 'number of sessions without a sweep for 60+ minutes'),
     ConnStat('read_io', 'total read I/Os'),
@@ -251,6 +253,7 @@ conn_stats = [
     BlockStat('block_byte_write_syscall', 'bytes written via system call API', 'size'),
     BlockStat('block_map_read', 'mapped blocks read'),
     BlockStat('block_preload', 'blocks pre-loaded'),
+    BlockStat('block_preload_skipped', 'tree pre-loads skipped during recovery'),
     BlockStat('block_read', 'blocks read'),
     BlockStat('block_remap_file_resize', 'number of times the file was remapped because it changed size via fallocate or truncate'),
     BlockStat('block_remap_file_write', 'number of times the region was remapped via write'),
@@ -468,6 +471,7 @@ conn_stats = [
     # Cursor operations
     ##########################################
     CursorStat('cursor_bulk_count', 'bulk cursor count', 'no_clear,no_scale'),
+    CursorStat('cursor_bulk_runs', 'cursor bulk-load runs built in parallel'),
     CursorStat('cursor_cache', 'cursor close calls that result in cache'),
     CursorStat('cursor_cached_count', 'cached cursor count', 'no_clear,no_scale'),
     CursorStat('cursor_create', 'cursor create calls'),
@@ -505,6 +509,7 @@ conn_stats = [
     ##########################################
     # Dhandle statistics
     ##########################################
+    DhandleStat('dh_conn_find_nolock', 'connection data handles found without the handle list lock'),
     DhandleStat('dh_conn_handle_btree_count', 'btree connection data handles currently active', 'no_clear,no_scale'),
     DhandleStat('dh_conn_handle_checkpoint_count', 'checkpoint connection data handles currently active', 'no_clear,no_scale'),
     # dh_conn_handle_count = The sum of dh_conn_handle_{btree,table,tiered,tiered_tree}_count.
@@ -517,6 +522,7 @@ conn_stats = [
     DhandleStat('dh_session_sweeps', 'session sweep attempts'),
     # dh_sweep_dead_close formerly called dh_sweep_close.
     DhandleStat('dh_sweep_dead_close', 'connection sweep dead dhandles closed'),
+    DhandleStat('dh_sweep_examined', 'connection sweep dhandles examined'),
     DhandleStat('dh_sweep_expired_close', 'connection sweep expired dhandles closed'),
     # Note dh_sweep_total_close = dh_sweep_dead_close + dh_sweep_expired_close
     DhandleStat('dh_sweep_ref', 'connection sweep candidate became referenced'),
@@ -676,6 +682,9 @@ conn_stats = [
     RecStat('rec_time_window_pages_prepared', 'pages written including at least one prepare state'),
     RecStat('rec_time_window_pages_start_ts', 'pages written including at least one start timestamp'),
     RecStat('rec_time_window_prepared', 'records written including a prepare state'),
+    RecStat('rec_write_inline', 'blocks queued for the write threads written by the reconciling thread'),
+    RecStat('rec_write_queued', 'blocks queued for the write threads'),
+    RecStat('rec_write_wait', 'reconciliation calls that waited for the write threads'),
 
     ##########################################
     # Session operations
@@ -905,6 +914,7 @@ dsrc_stats = [
     ##########################################
     # Cursor operations
     ##########################################
+    CursorStat('cursor_bulk_runs', 'bulk-load runs built in parallel'),
     CursorStat('cursor_cache', 'close calls that result in cache'),
     CursorStat('cursor_create', 'create calls'),
     CursorStat('cursor_insert', 'insert calls'),
@@ -146,9 +146,18 @@ __wt_btree_open(WT_SESSION_IMPL *session, const char *op_cfg[])
         else {
             WT_ERR(__wti_btree_tree_open(session, root_addr, root_addr_size));
 
-            /* Warm the cache, if possible. */
-            WT_WITH_PAGE_INDEX(session, ret = __btree_preload(session));
-            WT_ERR(ret);
+            /*
+             * Warm the cache, if possible. Don't during recovery: recovery and rollback to stable
+             * only open trees they have work to do in, and read the pages they need as they go.
+             * With many trees, reading every tree's second-level internal pages adds up to a lot of
+             * startup time for pages that may never be used.
+             */
+            if (F_ISSET(S2C(session), WT_CONN_RECOVERING))
+                WT_STAT_CONN_INCR(session, block_preload_skipped);
+            else {
+                WT_WITH_PAGE_INDEX(session, ret = __btree_preload(session));
+                WT_ERR(ret);
+            }
 
             /* Get the last record number in a column-store file. */
             if (btree->type != BTREE_ROW)
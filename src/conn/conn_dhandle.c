@@ -165,6 +165,46 @@ __conn_dhandle_destroy(WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle, bool f
     return (ret);
 }
 
+/*
+ * __conn_dhandle_hash_insert --
+ *     Publish a data handle on its hash chain.
+ */
+static void
+__conn_dhandle_hash_insert(WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle, uint64_t bucket)
+{
+    WT_CONNECTION_IMPL *conn;
+
+    conn = S2C(session);
+
+    WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_WRITE));
+
+    /* Readers walk the chain without a lock, the handle must be complete before it's visible. */
+    dhandle->hash_next = conn->dhhash[bucket];
+    WT_RELEASE_WRITE(conn->dhhash[bucket], dhandle);
+}
+
+/*
+ * __conn_dhandle_hash_remove --
+ *     Unlink a data handle from its hash chain. The handle's next pointer is left alone, readers
+ *     already positioned on the handle continue their search from it.
+ */
+static void
+__conn_dhandle_hash_remove(WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle, uint64_t bucket)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DATA_HANDLE **prevp;
+
+    conn = S2C(session);
+
+    WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_WRITE));
+
+    for (prevp = &conn->dhhash[bucket]; *prevp != NULL; prevp = &(*prevp)->hash_next)
+        if (*prevp == dhandle) {
+            WT_RELEASE_WRITE(*prevp, dhandle->hash_next);
+            return;
+        }
+}
+
 /*
  * __wt_conn_dhandle_alloc --
  *     Allocate a new data handle and return it linked into the connection's list.
@@ -178,7 +218,7 @@ __wt_conn_dhandle_alloc(WT_SESSION_IMPL *session, const char *uri, const char *c
     WT_TABLE *table;
     WT_TIERED *tiered;
     WT_TIERED_TREE *tiered_tree;
-    uint64_t bucket;
+    uint64_t bucket, now;
 
     /*
      * Ensure no one beat us to creating the handle now that we hold the write lock.
@@ -236,6 +276,13 @@ __wt_conn_dhandle_alloc(WT_SESSION_IMPL *session, const char *uri, const char *c
      */
     bucket = dhandle->name_hash & (S2C(session)->dh_hash_size - 1);
     WT_CONN_DHANDLE_INSERT(S2C(session), dhandle, bucket);
+    __conn_dhandle_hash_insert(session, dhandle, bucket);
+
+    /* Have the sweep server look at the handle once it could have become idle. */
+    if (S2C(session)->sweep_idle_time != 0) {
+        now = __wt_atomic_load64(&S2C(session)->sweep_wheel.now);
+        __wti_sweep_wheel_schedule(session, dhandle, now + S2C(session)->sweep_idle_time);
+    }
 
     session->dhandle = dhandle;
     return (0);
@@ -245,6 +292,24 @@ err:
     return (ret);
 }
 
+/*
+ * __conn_dhandle_hash_match --
+ *     Return if a handle on a hash chain matches a name and checkpoint.
+ */
+static WT_INLINE bool
+__conn_dhandle_hash_match(
+  WT_DATA_HANDLE *dhandle, uint64_t hash, const char *uri, const char *checkpoint)
+{
+    if (dhandle->name_hash != hash || F_ISSET(dhandle, WT_DHANDLE_DEAD))
+        return (false);
+    if (checkpoint == NULL) {
+        if (dhandle->checkpoint != NULL)
+            return (false);
+    } else if (dhandle->checkpoint == NULL || strcmp(checkpoint, dhandle->checkpoint) != 0)
+        return (false);
+    return (strcmp(uri, dhandle->name) == 0);
+}
+
 /*
  * __wt_conn_dhandle_find --
  *     Find a previously opened data handle.
@@ -254,37 +319,72 @@ __wt_conn_dhandle_find(WT_SESSION_IMPL *session, const char *uri, const char *ch
 {
     WT_CONNECTION_IMPL *conn;
     WT_DATA_HANDLE *dhandle;
-    uint64_t bucket;
+    uint64_t bucket, hash;
 
     conn = S2C(session);
 
     /* We must be holding the handle list lock at a higher level. */
     WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST));
 
-    bucket = __wt_hash_city64(uri, strlen(uri)) & (conn->dh_hash_size - 1);
-    if (checkpoint == NULL) {
-        TAILQ_FOREACH (dhandle, &conn->dhhash[bucket], hashq) {
-            if (F_ISSET(dhandle, WT_DHANDLE_DEAD))
-                continue;
-            if (dhandle->checkpoint == NULL && strcmp(uri, dhandle->name) == 0) {
-                session->dhandle = dhandle;
-                return (0);
-            }
-        }
-    } else
-        TAILQ_FOREACH (dhandle, &conn->dhhash[bucket], hashq) {
-            if (F_ISSET(dhandle, WT_DHANDLE_DEAD))
-                continue;
-            if (dhandle->checkpoint != NULL && strcmp(uri, dhandle->name) == 0 &&
-              strcmp(checkpoint, dhandle->checkpoint) == 0) {
-                session->dhandle = dhandle;
-                return (0);
-            }
+    hash = __wt_hash_city64(uri, strlen(uri));
+    bucket = hash & (conn->dh_hash_size - 1);
+    for (dhandle = conn->dhhash[bucket]; dhandle != NULL; dhandle = dhandle->hash_next)
+        if (__conn_dhandle_hash_match(dhandle, hash, uri, checkpoint)) {
+            session->dhandle = dhandle;
+            return (0);
         }
 
     return (WT_NOTFOUND);
 }
 
+/*
+ * __wt_conn_dhandle_find_nolock --
+ *     Find a previously opened data handle without the handle list lock, acquiring a reference on
+ *     the handle if it's found.
+ */
+int
+__wt_conn_dhandle_find_nolock(WT_SESSION_IMPL *session, const char *uri, const char *checkpoint)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DATA_HANDLE *dhandle;
+    WT_DECL_RET;
+    uint64_t bucket, hash;
+
+    conn = S2C(session);
+    ret = WT_NOTFOUND;
+
+    hash = __wt_hash_city64(uri, strlen(uri));
+    bucket = hash & (conn->dh_hash_size - 1);
+
+    /*
+     * Handles unlinked from the chain aren't freed until the data handle generation drains, which
+     * makes it safe to walk the chain and look inside the handles without a lock.
+     */
+    WT_ENTER_GENERATION(session, WT_GEN_DHANDLE);
+    WT_ACQUIRE_READ(dhandle, conn->dhhash[bucket]);
+    while (dhandle != NULL && !__conn_dhandle_hash_match(dhandle, hash, uri, checkpoint))
+        WT_ACQUIRE_READ(dhandle, dhandle->hash_next);
+
+    /*
+     * Removal flags the handle and then checks its references, we take a reference and then check
+     * the flag: either removal sees our reference or we see the flag. If the handle is being
+     * removed, leave it to the caller to retry with the handle list lock.
+     */
+    if (dhandle != NULL) {
+        WT_DHANDLE_ACQUIRE(dhandle);
+        WT_FULL_BARRIER();
+        if (__wt_atomic_loadbool(&dhandle->hash_removed))
+            WT_DHANDLE_RELEASE(dhandle);
+        else {
+            session->dhandle = dhandle;
+            ret = 0;
+        }
+    }
+    WT_LEAVE_GENERATION(session, WT_GEN_DHANDLE);
+
+    return (ret);
+}
+
 /*
  * __wt_conn_dhandle_close --
  *     Sync and close the underlying btree handle.
@@ -453,6 +553,9 @@ __wt_conn_dhandle_close(WT_SESSION_IMPL *session, bool final, bool mark_dead, bo
     }
     WT_ASSERT(session, F_ISSET(dhandle, WT_DHANDLE_DEAD) || !F_ISSET(dhandle, WT_DHANDLE_OPEN));
 
+    /* Have the sweep server discard the dead handle or remove the closed handle. */
+    __wti_sweep_wheel_schedule(session, dhandle, 0);
+
 err:
     __wt_spin_unlock(session, &dhandle->close_lock);
 
@@ -695,7 +798,7 @@ __wt_conn_btree_apply(WT_SESSION_IMPL *session, const char *uri,
 
         for (dhandle = NULL;;) {
             WT_WITH_HANDLE_LIST_READ_LOCK(
-              session, WT_DHANDLE_NEXT(session, dhandle, &conn->dhhash[bucket], hashq));
+              session, WT_DHANDLE_HASH_NEXT(session, dhandle, conn->dhhash[bucket]));
             if (dhandle == NULL)
                 return (0);
 
@@ -808,7 +911,7 @@ __wt_conn_dhandle_close_all(
     WT_ERR(__conn_dhandle_close_one(session, uri, NULL, removed, mark_dead, check_visibility));
 
     bucket = __wt_hash_city64(uri, strlen(uri)) & (conn->dh_hash_size - 1);
-    TAILQ_FOREACH (dhandle, &conn->dhhash[bucket], hashq) {
+    for (dhandle = conn->dhhash[bucket]; dhandle != NULL; dhandle = dhandle->hash_next) {
         if (strcmp(dhandle->name, uri) != 0 || dhandle->checkpoint == NULL ||
           F_ISSET(dhandle, WT_DHANDLE_DEAD))
             continue;
@@ -840,13 +943,23 @@ __conn_dhandle_remove(WT_SESSION_IMPL *session, bool final)
     WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_WRITE));
     WT_ASSERT(session, dhandle != conn->evict->walk_tree);
 
-    /* Check if the handle was reacquired by a session while we waited. */
+    /*
+     * Check if the handle was reacquired by a session while we waited. Sessions acquire references
+     * without the handle list lock, flag the handle before checking so they either see the flag or
+     * we see their reference.
+     */
+    __wt_atomic_storebool(&dhandle->hash_removed, true);
+    WT_FULL_BARRIER();
     if (!final &&
       (__wt_atomic_loadi32(&dhandle->session_inuse) != 0 ||
-        __wt_atomic_load32(&dhandle->references) != 0))
+        __wt_atomic_load32(&dhandle->references) != 0)) {
+        __wt_atomic_storebool(&dhandle->hash_removed, false);
         return (__wt_set_return(session, EBUSY));
+    }
 
     WT_CONN_DHANDLE_REMOVE(conn, dhandle, bucket);
+    __conn_dhandle_hash_remove(session, dhandle, bucket);
+    __wti_sweep_wheel_remove(session, dhandle);
     return (0);
 }
 
@@ -889,9 +1002,12 @@ __wti_conn_dhandle_discard_single(WT_SESSION_IMPL *session, bool final, bool mar
     WT_TRET(tret);
 
     /*
-     * After successfully removing the handle, clean it up.
+     * After successfully removing the handle, wait for lock-free readers that might still be looking
+     * at it, then clean it up. There are no readers in the final close of the connection.
      */
     if (ret == 0 || final) {
+        if (!final)
+            __wt_gen_next_drain(session, WT_GEN_DHANDLE);
         WT_TRET(__conn_dhandle_destroy(session, dhandle, final));
         session->dhandle = NULL;
     }
@@ -17,6 +17,7 @@ __wti_connection_init(WT_CONNECTION_IMPL *conn)
 {
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
+    u_int i, j;
 
     session = conn->default_session;
 
@@ -31,6 +32,14 @@ __wti_connection_init(WT_CONNECTION_IMPL *conn)
     TAILQ_INIT(&conn->storagesrcqh);          /* Storage source list */
     TAILQ_INIT(&conn->tieredqh);              /* Tiered work unit list */
     TAILQ_INIT(&conn->pfqh);                  /* Pre-fetch reference list */
+    TAILQ_INIT(&conn->rwqh);                  /* Reconciliation write queue */
+
+    /* Handle sweep timing wheel. */
+    for (i = 0; i < WT_SWEEP_WHEEL_LEVELS; ++i)
+        for (j = 0; j < WT_SWEEP_WHEEL_SLOTS; ++j)
+            TAILQ_INIT(&conn->sweep_wheel.slots[i][j]);
+    TAILQ_INIT(&conn->sweep_wheel.due);
+    __wt_seconds(session, &conn->sweep_wheel.now);
 
     /* Random numbers. */
     __wt_random_init(&session->rnd);
@@ -53,14 +62,17 @@ __wti_connection_init(WT_CONNECTION_IMPL *conn)
     WT_RET(__wt_spin_init(session, &conn->reconfig_lock, "reconfigure"));
     WT_SPIN_INIT_SESSION_TRACKED(session, &conn->schema_lock, schema);
     WT_RET(__wt_spin_init(session, &conn->storage_lock, "tiered storage"));
+    WT_RET(__wt_spin_init(session, &conn->sweep_wheel.lock, "sweep wheel"));
     WT_RET(__wt_spin_init(session, &conn->tiered_lock, "tiered work unit list"));
     WT_RET(__wt_spin_init(session, &conn->turtle_lock, "turtle file"));
     WT_RET(__wt_spin_init(session, &conn->prefetch_lock, "prefetch"));
+    WT_RET(__wt_spin_init(session, &conn->rec_write_lock, "reconcile write"));
 
     /* Read-write locks */
     WT_RET(__wt_rwlock_init(session, &conn->debug_log_retention_lock));
     WT_RWLOCK_INIT_SESSION_TRACKED(session, &conn->dhandle_lock, dhandle);
     WT_RET(__wt_rwlock_init(session, &conn->hot_backup_lock));
+    WT_RET(__wt_rwlock_init(session, &conn->meta_ckpt_cache.lock));
     WT_RWLOCK_INIT_TRACKED(session, &conn->table_lock, table);
 
     /* Initialize the generation manager. */
@@ -117,14 +129,17 @@ __wti_connection_destroy(WT_CONNECTION_IMPL *conn)
     __wt_spin_destroy(session, &conn->fh_lock);
     __wt_spin_destroy(session, &conn->flush_tier_lock);
     __wt_rwlock_destroy(session, &conn->hot_backup_lock);
+    __wt_rwlock_destroy(session, &conn->meta_ckpt_cache.lock);
     __wt_spin_destroy(session, &conn->metadata_lock);
     __wt_spin_destroy(session, &conn->reconfig_lock);
     __wt_spin_destroy(session, &conn->schema_lock);
     __wt_spin_destroy(session, &conn->storage_lock);
+    __wt_spin_destroy(session, &conn->sweep_wheel.lock);
     __wt_rwlock_destroy(session, &conn->table_lock);
     __wt_spin_destroy(session, &conn->tiered_lock);
     __wt_spin_destroy(session, &conn->turtle_lock);
     __wt_spin_destroy(session, &conn->prefetch_lock);
+    __wt_spin_destroy(session, &conn->rec_write_lock);
 
     /* Free allocated hash buckets. */
     __wt_free(session, conn->blockhash);
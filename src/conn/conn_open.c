@@ -104,6 +104,8 @@ __wti_connection_close(WT_CONNECTION_IMPL *conn)
 
     /* The eviction server is shut down last. */
     WT_TRET(__wt_evict_threads_destroy(session));
+    /* Eviction hands blocks to the reconciliation write threads, shut them down after eviction. */
+    WT_TRET(__wti_rec_write_destroy(session));
     /* The capacity server can only be shut down after all I/O is complete. */
     WT_TRET(__wti_capacity_server_destroy(session));
 
@@ -267,6 +269,9 @@ __wti_connection_workers(WT_SESSION_IMPL *session, const char *cfg[])
      */
     WT_RET(__wt_logmgr_open(session));
 
+    /* Start the optional reconciliation write threads, before eviction that uses them. */
+    WT_RET(__wti_rec_write_create(session, cfg));
+
     /*
      * Start eviction threads. NOTE: Eviction must be started after the history store table is
      * created.
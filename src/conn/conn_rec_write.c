@@ -0,0 +1,203 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __rec_write_thread_chk --
+ *     Check to decide if the reconciliation write thread should continue running.
+ */
+static bool
+__rec_write_thread_chk(WT_SESSION_IMPL *session)
+{
+    return (F_ISSET(S2C(session), WT_CONN_REC_WRITE_RUN));
+}
+
+/*
+ * __rec_write_thread_run --
+ *     Entry function for a reconciliation write thread. This is called repeatedly from the thread
+ *     group code so it does not need to loop itself.
+ */
+static int
+__rec_write_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_REC_WRITE_JOB *job;
+
+    WT_UNUSED(thread);
+    WT_ASSERT(session, session->id != 0);
+    conn = S2C(session);
+
+    if (F_ISSET(conn, WT_CONN_REC_WRITE_RUN) && TAILQ_EMPTY(&conn->rwqh))
+        __wt_cond_wait(session, conn->rec_write_threads.wait_cond, WT_THOUSAND * WT_THOUSAND, NULL);
+
+    for (;;) {
+        __wt_spin_lock(session, &conn->rec_write_lock);
+        if ((job = TAILQ_FIRST(&conn->rwqh)) == NULL) {
+            __wt_spin_unlock(session, &conn->rec_write_lock);
+            break;
+        }
+        TAILQ_REMOVE(&conn->rwqh, job, q);
+        job->queued = false;
+        __wt_spin_unlock(session, &conn->rec_write_lock);
+
+        /*
+         * The reconciling thread holds the tree open until all of its blocks are written, it's
+         * safe to switch to the job's handle without acquiring it. Write errors are returned to
+         * the reconciling thread, they don't stop the write thread.
+         */
+        WT_WITH_DHANDLE(session, job->dhandle, job->ret = __wt_rec_write_job_run(session, job));
+
+        /*
+         * Signal the owner while holding the lock: once the owner sees its pending count go to
+         * zero under the lock, no write thread references its reconciliation structure.
+         */
+        __wt_spin_lock(session, &conn->rec_write_lock);
+        --job->r->write_jobs_pending;
+        __wt_cond_signal(session, job->r->write_cond);
+        __wt_spin_unlock(session, &conn->rec_write_lock);
+    }
+
+    return (0);
+}
+
+/*
+ * __wti_rec_write_create --
+ *     Start the reconciliation write threads.
+ */
+int
+__wti_rec_write_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+    WT_CONFIG_ITEM cval;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    uint32_t session_flags;
+
+    conn = S2C(session);
+
+    WT_RET(__wt_config_gets(session, cfg, "reconcile.write_threads", &cval));
+    conn->rec_write_threads_num = (uint32_t)cval.val;
+
+    /*
+     * In-memory and read-only databases don't write blocks, and the write threads aren't runtime
+     * configurable: don't bother starting them if they won't be used.
+     */
+    if (conn->rec_write_threads_num == 0 || F_ISSET(conn, WT_CONN_IN_MEMORY | WT_CONN_READONLY))
+        return (0);
+
+    F_SET(conn, WT_CONN_REC_WRITE_RUN);
+
+    session_flags = WT_THREAD_CAN_WAIT | WT_THREAD_PANIC_FAIL;
+    WT_ERR(__wt_thread_group_create(session, &conn->rec_write_threads, "reconcile-write-server",
+      conn->rec_write_threads_num, conn->rec_write_threads_num, session_flags,
+      __rec_write_thread_chk, __rec_write_thread_run, NULL));
+    return (0);
+
+err:
+    /* Quit the write threads. */
+    WT_TRET(__wti_rec_write_destroy(session));
+    return (ret);
+}
+
+/*
+ * __wt_conn_rec_write_queue_push --
+ *     Push a block image onto the reconciliation write queue. Return false if the write threads
+ *     aren't running and the caller must write the block itself.
+ */
+bool
+__wt_conn_rec_write_queue_push(WT_SESSION_IMPL *session, WT_REC_WRITE_JOB *job)
+{
+    WT_CONNECTION_IMPL *conn;
+
+    conn = S2C(session);
+
+    __wt_spin_lock(session, &conn->rec_write_lock);
+    if (!F_ISSET(conn, WT_CONN_REC_WRITE_RUN)) {
+        __wt_spin_unlock(session, &conn->rec_write_lock);
+        return (false);
+    }
+    TAILQ_INSERT_TAIL(&conn->rwqh, job, q);
+    job->queued = true;
+    ++job->r->write_jobs_pending;
+    __wt_spin_unlock(session, &conn->rec_write_lock);
+
+    __wt_cond_signal(session, conn->rec_write_threads.wait_cond);
+    WT_STAT_CONN_INCR(session, rec_write_queued);
+    return (true);
+}
+
+/*
+ * __wt_conn_rec_write_queue_remove --
+ *     Remove a block image from the reconciliation write queue if no write thread has claimed it
+ *     yet, the caller then owns the write. Return if the job was removed.
+ */
+bool
+__wt_conn_rec_write_queue_remove(WT_SESSION_IMPL *session, WT_REC_WRITE_JOB *job)
+{
+    WT_CONNECTION_IMPL *conn;
+    bool removed;
+
+    conn = S2C(session);
+
+    __wt_spin_lock(session, &conn->rec_write_lock);
+    if ((removed = job->queued)) {
+        TAILQ_REMOVE(&conn->rwqh, job, q);
+        job->queued = false;
+        --job->r->write_jobs_pending;
+    }
+    __wt_spin_unlock(session, &conn->rec_write_lock);
+    return (removed);
+}
+
+/*
+ * __wt_conn_rec_write_pending --
+ *     Return the number of a reconciliation's block images not yet written by the write threads.
+ */
+uint32_t
+__wt_conn_rec_write_pending(WT_SESSION_IMPL *session, WT_RECONCILE *r)
+{
+    WT_CONNECTION_IMPL *conn;
+    uint32_t pending;
+
+    conn = S2C(session);
+
+    __wt_spin_lock(session, &conn->rec_write_lock);
+    pending = r->write_jobs_pending;
+    __wt_spin_unlock(session, &conn->rec_write_lock);
+    return (pending);
+}
+
+/*
+ * __wti_rec_write_destroy --
+ *     Destroy the reconciliation write threads.
+ */
+int
+__wti_rec_write_destroy(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+
+    conn = S2C(session);
+
+    if (!F_ISSET(conn, WT_CONN_REC_WRITE_RUN))
+        return (0);
+
+    /*
+     * Stop accepting work. Anything still queued is written by the reconciling threads as they
+     * collect their blocks, so there's no need to drain the queue here.
+     */
+    __wt_spin_lock(session, &conn->rec_write_lock);
+    F_CLR(conn, WT_CONN_REC_WRITE_RUN);
+    __wt_spin_unlock(session, &conn->rec_write_lock);
+
+    /* Let any running threads finish up. */
+    __wt_cond_signal(session, conn->rec_write_threads.wait_cond);
+
+    __wt_writelock(session, &conn->rec_write_threads.lock);
+
+    return (__wt_thread_group_destroy(session, &conn->rec_write_threads));
+}
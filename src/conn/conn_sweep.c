@@ -8,53 +8,225 @@
 
 #include "wt_internal.h"
 
-#define WT_DHANDLE_CAN_DISCARD(dhandle)                           \
+/*
+ * Check if a handle can be discarded: it must be closed and unused, other than the given number of
+ * references.
+ */
+#define WT_DHANDLE_CAN_DISCARD(dhandle, refs)                     \
     (!F_ISSET(dhandle, WT_DHANDLE_EXCLUSIVE | WT_DHANDLE_OPEN) && \
       __wt_atomic_loadi32(&(dhandle)->session_inuse) == 0 &&      \
-      __wt_atomic_load32(&(dhandle)->references) == 0)
+      __wt_atomic_load32(&(dhandle)->references) == (refs))
 
 /*
- * __sweep_mark --
- *     Mark idle handles with a time of death, and note if we see dead handles.
+ * __sweep_wheel_insert --
+ *     Link a handle into the timing wheel slot for the time the sweep server next needs to look at
+ *     it. Called with the wheel locked.
  */
 static void
-__sweep_mark(WT_SESSION_IMPL *session, uint64_t now)
+__sweep_wheel_insert(WT_SWEEP_WHEEL *wheel, WT_DATA_HANDLE *dhandle)
 {
-    WT_CONNECTION_IMPL *conn;
+    struct __wt_sweep_qh *head;
+    uint64_t delta, when;
+    u_int level;
+
+    when = dhandle->sweep_time;
+    if (when <= wheel->now)
+        head = &wheel->due;
+    else {
+        /*
+         * Handles beyond the range of the wheel are parked in the furthest slot, the sweep server
+         * will reschedule them when it gets there.
+         */
+        delta = when - wheel->now;
+        if (delta >= WT_SWEEP_WHEEL_RANGE) {
+            delta = WT_SWEEP_WHEEL_RANGE - 1;
+            when = wheel->now + delta;
+        }
+        for (level = 0; level < WT_SWEEP_WHEEL_LEVELS - 1; ++level)
+            if (delta < (uint64_t)1 << (WT_SWEEP_WHEEL_BITS * (level + 1)))
+                break;
+        head = &wheel->slots[level][(when >> (WT_SWEEP_WHEEL_BITS * level)) & WT_SWEEP_WHEEL_MASK];
+    }
+    TAILQ_INSERT_TAIL(head, dhandle, sweepq);
+    dhandle->sweep_head = head;
+}
+
+/*
+ * __sweep_wheel_unlink --
+ *     Unlink a handle from the timing wheel, if it's there. Called with the wheel locked.
+ */
+static void
+__sweep_wheel_unlink(WT_DATA_HANDLE *dhandle)
+{
+    if (dhandle->sweep_head == NULL)
+        return;
+    TAILQ_REMOVE(dhandle->sweep_head, dhandle, sweepq);
+    dhandle->sweep_head = NULL;
+}
+
+/*
+ * __sweep_wheel_move --
+ *     Move every handle in a timing wheel slot back through the wheel. Called with the wheel
+ *     locked.
+ */
+static void
+__sweep_wheel_move(WT_SWEEP_WHEEL *wheel, struct __wt_sweep_qh *head)
+{
+    struct __wt_sweep_qh moveq;
     WT_DATA_HANDLE *dhandle;
 
-    conn = S2C(session);
+    /*
+     * Empty the slot before reinserting anything: a handle could otherwise be put back in the slot
+     * we're emptying and we'd never finish.
+     */
+    TAILQ_INIT(&moveq);
+    while ((dhandle = TAILQ_FIRST(head)) != NULL) {
+        TAILQ_REMOVE(head, dhandle, sweepq);
+        TAILQ_INSERT_TAIL(&moveq, dhandle, sweepq);
+    }
+    while ((dhandle = TAILQ_FIRST(&moveq)) != NULL) {
+        TAILQ_REMOVE(&moveq, dhandle, sweepq);
+        __sweep_wheel_insert(wheel, dhandle);
+    }
+}
 
-    TAILQ_FOREACH (dhandle, &conn->dhqh, q) {
-        if (WT_IS_METADATA(dhandle))
-            continue;
+/*
+ * __sweep_wheel_move_due --
+ *     Move every handle in a timing wheel slot to the due queue. Called with the wheel locked.
+ */
+static void
+__sweep_wheel_move_due(WT_SWEEP_WHEEL *wheel, struct __wt_sweep_qh *head)
+{
+    WT_DATA_HANDLE *dhandle;
 
-        /*
-         * There are some internal increments of the in-use count such as eviction. Don't keep
-         * handles alive because of those cases, but if we see multiple cursors open, clear the time
-         * of death.
-         */
-        if (__wt_atomic_loadi32(&dhandle->session_inuse) > 1)
-            dhandle->timeofdeath = 0;
+    while ((dhandle = TAILQ_FIRST(head)) != NULL) {
+        TAILQ_REMOVE(head, dhandle, sweepq);
+        TAILQ_INSERT_TAIL(&wheel->due, dhandle, sweepq);
+        dhandle->sweep_head = &wheel->due;
+    }
+}
 
-        /*
-         * If the handle is open exclusive or currently in use, or the time of death is already set,
-         * move on.
-         */
-        if (F_ISSET(dhandle, WT_DHANDLE_EXCLUSIVE) ||
-          __wt_atomic_loadi32(&dhandle->session_inuse) > 0 || dhandle->timeofdeath != 0)
-            continue;
+/*
+ * __sweep_wheel_advance --
+ *     Advance the timing wheel, cascading handles down through the levels and moving the handles
+ *     whose time has come to the due queue. Called with the wheel locked.
+ */
+static void
+__sweep_wheel_advance(WT_SWEEP_WHEEL *wheel, uint64_t now)
+{
+    uint64_t tick;
+    u_int level, slot;
+
+    if (now <= wheel->now)
+        return;
+
+    /*
+     * If the wheel has fallen a long way behind (perhaps the clock moved), everything is due. Don't
+     * reinsert handles based on their times, some may still be in the future of the old wheel.
+     */
+    if (now - wheel->now >= WT_SWEEP_WHEEL_RANGE) {
+        __wt_atomic_store64(&wheel->now, now);
+        for (level = 0; level < WT_SWEEP_WHEEL_LEVELS; ++level)
+            for (slot = 0; slot < WT_SWEEP_WHEEL_SLOTS; ++slot)
+                __sweep_wheel_move_due(wheel, &wheel->slots[level][slot]);
+        return;
+    }
+
+    while (wheel->now < now) {
+        tick = wheel->now + 1;
+        __wt_atomic_store64(&wheel->now, tick);
 
         /*
-         * Never close out the history store handle via sweep. It can cause a deadlock if eviction
-         * needs to re-open a handle to the history store while a checkpoint is getting started.
+         * Cascade the higher level slots that start at this tick, highest level first, so handles
+         * can drop more than one level at a time.
          */
-        if (WT_IS_HS(dhandle))
-            continue;
+        for (level = WT_SWEEP_WHEEL_LEVELS - 1; level > 0; --level) {
+            if ((tick & (((uint64_t)1 << (WT_SWEEP_WHEEL_BITS * level)) - 1)) != 0)
+                continue;
+            slot = (u_int)(tick >> (WT_SWEEP_WHEEL_BITS * level)) & WT_SWEEP_WHEEL_MASK;
+            __sweep_wheel_move(wheel, &wheel->slots[level][slot]);
+        }
 
-        dhandle->timeofdeath = now;
-        WT_STAT_CONN_INCR(session, dh_sweep_tod);
+        /* Everything in the level 0 slot for this tick is due. */
+        __sweep_wheel_move(wheel, &wheel->slots[0][tick & WT_SWEEP_WHEEL_MASK]);
+    }
+}
+
+/*
+ * __wti_sweep_wheel_schedule --
+ *     Schedule the sweep server to look at a handle at the given time, unless it's already
+ *     scheduled to do so sooner.
+ */
+void
+__wti_sweep_wheel_schedule(WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle, uint64_t when)
+{
+    WT_SWEEP_WHEEL *wheel;
+
+    wheel = &S2C(session)->sweep_wheel;
+
+    __wt_spin_lock(session, &wheel->lock);
+    if (dhandle->sweep_head == NULL || when < dhandle->sweep_time) {
+        __sweep_wheel_unlink(dhandle);
+        dhandle->sweep_time = when;
+        __sweep_wheel_insert(wheel, dhandle);
+    }
+    __wt_spin_unlock(session, &wheel->lock);
+}
+
+/*
+ * __wti_sweep_wheel_remove --
+ *     Remove a handle from the sweep timing wheel.
+ */
+void
+__wti_sweep_wheel_remove(WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle)
+{
+    WT_SWEEP_WHEEL *wheel;
+
+    wheel = &S2C(session)->sweep_wheel;
+
+    __wt_spin_lock(session, &wheel->lock);
+    __sweep_wheel_unlink(dhandle);
+    __wt_spin_unlock(session, &wheel->lock);
+}
+
+/*
+ * __sweep_wheel_rebuild --
+ *     Schedule every handle to be looked at now. Called with the handle list locked.
+ */
+static void
+__sweep_wheel_rebuild(WT_SESSION_IMPL *session, uint64_t now)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DATA_HANDLE *dhandle;
+
+    conn = S2C(session);
+
+    __wt_atomic_storebool(&conn->sweep_wheel.rebuild, false);
+    TAILQ_FOREACH (dhandle, &conn->dhqh, q)
+        __wti_sweep_wheel_schedule(session, dhandle, now);
+}
+
+/*
+ * __sweep_wheel_pop --
+ *     Return the next due handle, holding a reference to it. Called with the handle list locked:
+ *     handles can't be removed from the connection while we acquire the reference.
+ */
+static void
+__sweep_wheel_pop(WT_SESSION_IMPL *session, WT_DATA_HANDLE **dhandlep)
+{
+    WT_DATA_HANDLE *dhandle;
+    WT_SWEEP_WHEEL *wheel;
+
+    wheel = &S2C(session)->sweep_wheel;
+
+    __wt_spin_lock(session, &wheel->lock);
+    if ((dhandle = TAILQ_FIRST(&wheel->due)) != NULL) {
+        __sweep_wheel_unlink(dhandle);
+        WT_DHANDLE_ACQUIRE(dhandle);
     }
+    __wt_spin_unlock(session, &wheel->lock);
+
+    *dhandlep = dhandle;
 }
 
 /*
@@ -114,30 +286,61 @@ __sweep_expire_one(WT_SESSION_IMPL *session)
 
 /*
  * __sweep_expire --
- *     Mark trees dead if they are clean and haven't been accessed recently, until we have reached
- *     the configured minimum number of handles.
+ *     Mark an open handle with a time of death once it's idle, and mark it dead if it's clean and
+ *     hasn't been accessed recently, unless we have reached the configured minimum number of
+ *     handles. Set when the sweep server next needs to look at the handle, or 0 if it doesn't.
  */
 static int
-__sweep_expire(WT_SESSION_IMPL *session, uint64_t now)
+__sweep_expire(WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle, uint64_t now, uint64_t *nextp)
 {
     WT_CONNECTION_IMPL *conn;
-    WT_DATA_HANDLE *dhandle;
     WT_DECL_RET;
 
     conn = S2C(session);
+    *nextp = 0;
 
-    TAILQ_FOREACH (dhandle, &conn->dhqh, q) {
-        /*
-         * Ignore open files once the btree file count is below the minimum number of handles.
-         */
-        if (__wt_atomic_load32(&conn->open_btree_count) < conn->sweep_handles_min)
-            break;
+    /*
+     * Never close out the history store handle via sweep. It can cause a deadlock if eviction needs
+     * to re-open a handle to the history store while a checkpoint is getting started. If
+     * sweep_idle_time is 0, handles never become idle; if it's reconfigured, every handle is
+     * rescheduled.
+     */
+    if (WT_IS_HS(dhandle) || conn->sweep_idle_time == 0)
+        return (0);
 
-        if (WT_IS_METADATA(dhandle) || !F_ISSET(dhandle, WT_DHANDLE_OPEN) ||
-          __wt_atomic_loadi32(&dhandle->session_inuse) != 0 || dhandle->timeofdeath == 0 ||
-          now - dhandle->timeofdeath <= conn->sweep_idle_time)
-            continue;
+    /*
+     * There are some internal increments of the in-use count such as eviction. Don't keep handles
+     * alive because of those cases, but if we see multiple cursors open, clear the time of death.
+     */
+    if (__wt_atomic_loadi32(&dhandle->session_inuse) > 1)
+        dhandle->timeofdeath = 0;
+
+    /*
+     * If the handle is open exclusive or currently in use, check again shortly if it's only briefly
+     * held (it already has a time of death). Otherwise, it's open in a cursor: closing the last
+     * cursor sets the time of death, so the handle can't expire for at least the idle time.
+     */
+    if (F_ISSET(dhandle, WT_DHANDLE_EXCLUSIVE) ||
+      __wt_atomic_loadi32(&dhandle->session_inuse) > 0) {
+        *nextp = now + (dhandle->timeofdeath == 0 ? conn->sweep_idle_time : conn->sweep_interval);
+        return (0);
+    }
 
+    /*
+     * Closing the last cursor on a handle sets its time of death, set it here if the handle became
+     * idle some other way. Then wait for it to expire.
+     */
+    if (dhandle->timeofdeath == 0) {
+        dhandle->timeofdeath = now;
+        WT_STAT_CONN_INCR(session, dh_sweep_tod);
+    }
+    if (now - dhandle->timeofdeath <= conn->sweep_idle_time) {
+        *nextp = dhandle->timeofdeath + conn->sweep_idle_time + 1;
+        return (0);
+    }
+
+    /* Ignore open files once the btree file count is below the minimum number of handles. */
+    if (__wt_atomic_load32(&conn->open_btree_count) >= conn->sweep_handles_min) {
         /*
          * For tables, we need to hold the table lock to avoid racing with cursor opens.
          */
@@ -151,50 +354,41 @@ __sweep_expire(WT_SESSION_IMPL *session, uint64_t now)
             WT_STAT_CONN_INCR(session, dh_sweep_expired_close);
         else
             WT_STAT_CONN_INCR(session, dh_sweep_ref);
-
-        WT_RET_BUSY_OK(ret);
     }
 
-    return (0);
+    /*
+     * Handles marked dead were rescheduled by the close, retry anything else the next time the
+     * sweep server runs.
+     */
+    if (!F_ISSET(dhandle, WT_DHANDLE_DEAD))
+        *nextp = now + conn->sweep_interval;
+    return (ret);
 }
 
 /*
- * __sweep_discard_trees --
- *     Discard pages from dead trees.
+ * __sweep_discard_tree --
+ *     Discard pages from a dead tree.
  */
 static int
-__sweep_discard_trees(WT_SESSION_IMPL *session, u_int *dead_handlesp)
+__sweep_discard_tree(
+  WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle, uint64_t now, uint64_t *nextp)
 {
-    WT_CONNECTION_IMPL *conn;
-    WT_DATA_HANDLE *dhandle;
     WT_DECL_RET;
 
-    *dead_handlesp = 0;
-
-    conn = S2C(session);
-
-    TAILQ_FOREACH (dhandle, &conn->dhqh, q) {
-        if (WT_DHANDLE_CAN_DISCARD(dhandle))
-            ++*dead_handlesp;
-
-        if (!F_ISSET(dhandle, WT_DHANDLE_OPEN) || !F_ISSET(dhandle, WT_DHANDLE_DEAD))
-            continue;
-
-        /* If the handle is marked dead, flush it from cache. */
-        WT_WITH_DHANDLE(
-          session, dhandle, ret = __wt_conn_dhandle_close(session, false, false, false));
+    *nextp = 0;
 
-        /* We closed the btree handle. */
-        if (ret == 0) {
-            WT_STAT_CONN_INCR(session, dh_sweep_dead_close);
-            ++*dead_handlesp;
-        } else
-            WT_STAT_CONN_INCR(session, dh_sweep_ref);
+    /* If the handle is marked dead, flush it from cache. The close reschedules it for removal. */
+    WT_WITH_DHANDLE(session, dhandle, ret = __wt_conn_dhandle_close(session, false, false, false));
 
-        WT_RET_BUSY_OK(ret);
+    /* We closed the btree handle. */
+    if (ret == 0)
+        WT_STAT_CONN_INCR(session, dh_sweep_dead_close);
+    else {
+        WT_STAT_CONN_INCR(session, dh_sweep_ref);
+        *nextp = now + S2C(session)->sweep_interval;
     }
 
-    return (0);
+    return (ret);
 }
 
 /*
@@ -212,7 +406,7 @@ __sweep_remove_one(WT_SESSION_IMPL *session)
     /*
      * If there are no longer any references to the handle in any sessions, attempt to discard it.
      */
-    if (!WT_DHANDLE_CAN_DISCARD(session->dhandle))
+    if (!WT_DHANDLE_CAN_DISCARD(session->dhandle, 0))
         WT_ERR(EBUSY);
 
     ret = __wti_conn_dhandle_discard_single(session, false, true);
@@ -230,40 +424,118 @@ err:
 }
 
 /*
- * __sweep_remove_handles --
- *     Remove closed handles from the connection list.
+ * __sweep_remove_locked --
+ *     Remove a closed handle from the connection list, dropping the sweep server's reference to it.
+ *     Called with the handle list write locked.
  */
 static int
-__sweep_remove_handles(WT_SESSION_IMPL *session)
+__sweep_remove_locked(WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle, uint64_t now)
 {
-    WT_CONNECTION_IMPL *conn;
-    WT_DATA_HANDLE *dhandle, *dhandle_tmp;
     WT_DECL_RET;
 
-    conn = S2C(session);
+    /* Holding the handle list lock means the handle can't be freed once we drop our reference. */
+    WT_DHANDLE_RELEASE(dhandle);
 
-    TAILQ_FOREACH_SAFE(dhandle, &conn->dhqh, q, dhandle_tmp)
-    {
-        if (WT_IS_METADATA(dhandle))
-            continue;
-        if (!WT_DHANDLE_CAN_DISCARD(dhandle))
-            continue;
+    WT_WITH_DHANDLE(session, dhandle, ret = __sweep_remove_one(session));
+    if (ret != 0)
+        __wti_sweep_wheel_schedule(session, dhandle, now + S2C(session)->sweep_interval);
+    return (ret);
+}
 
-        if (__wt_atomic_load_enum(&dhandle->type) == WT_DHANDLE_TYPE_TABLE)
-            WT_WITH_TABLE_WRITE_LOCK(session,
-              WT_WITH_HANDLE_LIST_WRITE_LOCK(
-                session, WT_WITH_DHANDLE(session, dhandle, ret = __sweep_remove_one(session))));
-        else
-            WT_WITH_HANDLE_LIST_WRITE_LOCK(
-              session, WT_WITH_DHANDLE(session, dhandle, ret = __sweep_remove_one(session)));
-        if (ret == 0)
-            WT_STAT_CONN_INCR(session, dh_sweep_remove);
-        else
-            WT_STAT_CONN_INCR(session, dh_sweep_ref);
+/*
+ * __sweep_remove_handle --
+ *     Remove a closed handle from the connection list, dropping the sweep server's reference to it.
+ */
+static int
+__sweep_remove_handle(WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle, uint64_t now)
+{
+    WT_DECL_RET;
+
+    if (__wt_atomic_load_enum(&dhandle->type) == WT_DHANDLE_TYPE_TABLE)
+        WT_WITH_TABLE_WRITE_LOCK(session,
+          WT_WITH_HANDLE_LIST_WRITE_LOCK(
+            session, ret = __sweep_remove_locked(session, dhandle, now)));
+    else
+        WT_WITH_HANDLE_LIST_WRITE_LOCK(session, ret = __sweep_remove_locked(session, dhandle, now));
+    if (ret == 0)
+        WT_STAT_CONN_INCR(session, dh_sweep_remove);
+    else
+        WT_STAT_CONN_INCR(session, dh_sweep_ref);
+
+    return (ret);
+}
+
+/*
+ * __sweep_handle --
+ *     Look at a handle that's due, dropping the sweep server's reference to it.
+ */
+static int
+__sweep_handle(WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle, uint64_t now)
+{
+    WT_DECL_RET;
+    uint64_t next;
+
+    next = 0;
+
+    /* The metadata handle is never swept. */
+    if (WT_IS_METADATA(dhandle))
+        goto done;
+
+    /*
+     * Open handles age until they're marked dead, dead handles are flushed from the cache and
+     * closed, closed handles are removed from the connection. Each step schedules the handle again,
+     * so a handle can move through the steps in a single sweep.
+     */
+    if (!F_ISSET(dhandle, WT_DHANDLE_OPEN)) {
+        if (WT_DHANDLE_CAN_DISCARD(dhandle, 1))
+            return (__sweep_remove_handle(session, dhandle, now));
+        next = now + S2C(session)->sweep_interval;
+    } else if (F_ISSET(dhandle, WT_DHANDLE_DEAD))
+        ret = __sweep_discard_tree(session, dhandle, now, &next);
+    else
+        ret = __sweep_expire(session, dhandle, now, &next);
+
+done:
+    if (next != 0)
+        __wti_sweep_wheel_schedule(session, dhandle, next);
+    WT_DHANDLE_RELEASE(dhandle);
+    return (ret);
+}
+
+/*
+ * __sweep_wheel_run --
+ *     Look at the handles whose time has come. The cost is proportional to the number of handles
+ *     that are due rather than the number of handles in the connection.
+ */
+static int
+__sweep_wheel_run(WT_SESSION_IMPL *session, uint64_t now)
+{
+    WT_DATA_HANDLE *dhandle;
+    WT_DECL_RET;
+    WT_SWEEP_WHEEL *wheel;
+
+    wheel = &S2C(session)->sweep_wheel;
+
+    /* Don't schedule anything in the wheel's past if the clock went backwards. */
+    __wt_spin_lock(session, &wheel->lock);
+    __sweep_wheel_advance(wheel, now);
+    now = wheel->now;
+    __wt_spin_unlock(session, &wheel->lock);
+
+    if (__wt_atomic_loadbool(&wheel->rebuild))
+        WT_WITH_HANDLE_LIST_READ_LOCK(session, __sweep_wheel_rebuild(session, now));
+
+    for (;;) {
+        WT_WITH_HANDLE_LIST_READ_LOCK(session, __sweep_wheel_pop(session, &dhandle));
+        if (dhandle == NULL)
+            break;
+
+        WT_STAT_CONN_INCR(session, dh_sweep_examined);
+        ret = __sweep_handle(session, dhandle, now);
         WT_RET_BUSY_OK(ret);
     }
 
-    return (ret == EBUSY ? 0 : ret);
+    return (0);
 }
 
 /*
@@ -361,7 +633,6 @@ __sweep_server(void *arg)
     WT_SESSION_IMPL *session;
     uint64_t last, now;
     uint64_t sweep_interval;
-    u_int dead_handles;
     bool cv_signalled;
 
     session = arg;
@@ -401,25 +672,12 @@ __sweep_server(void *arg)
             continue;
         }
         WT_STAT_CONN_INCR(session, dh_sweeps);
-        /*
-         * Mark handles with a time of death, and report whether any handles are marked dead. If
-         * sweep_idle_time is 0, handles never become idle.
-         */
-        if (conn->sweep_idle_time != 0)
-            __sweep_mark(session, now);
 
         /*
-         * Close handles if we have reached the configured limit. If sweep_idle_time is 0, handles
-         * never become idle.
+         * Mark idle handles with a time of death, close expired and dead handles and remove closed
+         * handles from the connection, looking only at handles the timing wheel says are due.
          */
-        if (conn->sweep_idle_time != 0 &&
-          __wt_atomic_load32(&conn->open_btree_count) >= conn->sweep_handles_min)
-            WT_ERR(__sweep_expire(session, now));
-
-        WT_ERR(__sweep_discard_trees(session, &dead_handles));
-
-        if (dead_handles > 0)
-            WT_ERR(__sweep_remove_handles(session));
+        WT_ERR(__sweep_wheel_run(session, now));
 
         /*
          * Check for any "rogue" sessions, which did not run a session sweep in a long time.
@@ -446,6 +704,7 @@ __wti_sweep_config(WT_SESSION_IMPL *session, const char *cfg[])
 {
     WT_CONFIG_ITEM cval;
     WT_CONNECTION_IMPL *conn;
+    uint64_t idle_time;
 
     conn = S2C(session);
 
@@ -453,11 +712,17 @@ __wti_sweep_config(WT_SESSION_IMPL *session, const char *cfg[])
      * A non-zero idle time is incompatible with in-memory, and the default is non-zero; set the
      * in-memory configuration idle time to zero.
      */
-    conn->sweep_idle_time = 0;
+    idle_time = 0;
     WT_RET(__wt_config_gets(session, cfg, "in_memory", &cval));
     if (cval.val == 0) {
         WT_RET(__wt_config_gets(session, cfg, "file_manager.close_idle_time", &cval));
-        conn->sweep_idle_time = (uint64_t)cval.val;
+        idle_time = (uint64_t)cval.val;
+    }
+
+    /* Handles are scheduled in the sweep timing wheel based on the idle time. */
+    if (idle_time != conn->sweep_idle_time) {
+        conn->sweep_idle_time = idle_time;
+        __wt_atomic_storebool(&conn->sweep_wheel.rebuild, true);
     }
 
     WT_RET(__wt_config_gets(session, cfg, "file_manager.close_scan_interval", &cval));
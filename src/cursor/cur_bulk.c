@@ -181,6 +181,296 @@ err:
     API_END_RET(session, ret);
 }
 
+/*
+ * __curbulk_run_build --
+ *     Reconcile a parallel bulk-load run into leaf pages.
+ */
+static int
+__curbulk_run_build(WT_SESSION_IMPL *session, WT_BULK_PARALLEL *parallel, WT_BULK_RUN *run)
+{
+    WT_CURSOR *cursor;
+    WT_CURSOR_BULK *cbulk, *leader, _cbulk;
+    WT_DECL_RET;
+    size_t key_size;
+    uint64_t i, size;
+    const uint8_t *end, *p;
+    const void *key;
+
+    leader = parallel->cbulk;
+    WT_CLEAR(_cbulk);
+    cbulk = &_cbulk;
+    cursor = &cbulk->cbt.iface;
+
+    p = run->buf.data;
+    end = p + run->buf.size;
+
+    /*
+     * The first run starts at the key of the bulk cursor's leaf page, every other run starts at its
+     * own first key.
+     */
+    if (run->id == 0)
+        __wt_ref_key(leader->ref->home, leader->ref, &key, &key_size);
+    else {
+        WT_RET(__wt_vunpack_uint(&p, WT_PTRDIFF(end, p), &size));
+        key = p;
+        key_size = (size_t)size;
+        p = run->buf.data;
+    }
+    WT_ERR(__wt_bulk_run_init(session, leader, cbulk, key, key_size));
+
+    for (i = 0; i < run->count; ++i) {
+        WT_ERR(__wt_vunpack_uint(&p, WT_PTRDIFF(end, p), &size));
+        cursor->key.data = p;
+        cursor->key.size = (size_t)size;
+        p += size;
+        WT_ERR(__wt_vunpack_uint(&p, WT_PTRDIFF(end, p), &size));
+        cursor->value.data = p;
+        cursor->value.size = (size_t)size;
+        p += size;
+
+        WT_ERR(__wt_bulk_insert_row(session, cbulk));
+    }
+
+    WT_ERR(__wt_bulk_run_finish(session, cbulk, &run->multi, &run->multi_entries));
+
+err:
+    WT_TRET(__wt_bulk_run_discard(session, cbulk));
+    return (ret);
+}
+
+/*
+ * __curbulk_worker --
+ *     Parallel bulk-load worker thread: reconcile queued runs until the load completes.
+ */
+static WT_THREAD_RET
+__curbulk_worker(void *arg)
+{
+    WT_BULK_PARALLEL *parallel;
+    WT_BULK_RUN *run;
+    WT_BULK_WORKER *worker;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+    bool closing;
+
+    worker = arg;
+    parallel = worker->parallel;
+    session = worker->session;
+
+    for (;;) {
+        __wt_spin_lock(session, &parallel->lock);
+        run = parallel->runs_claimed < parallel->runs_next ?
+          parallel->runs[parallel->runs_claimed++] :
+          NULL;
+        closing = parallel->closing;
+        __wt_spin_unlock(session, &parallel->lock);
+
+        if (run == NULL) {
+            if (closing)
+                break;
+            __wt_cond_wait(session, parallel->work_cond, 10 * WT_THOUSAND, NULL);
+            continue;
+        }
+
+        WT_WITH_DHANDLE(
+          session, parallel->dhandle, ret = __curbulk_run_build(session, parallel, run));
+        __wt_buf_free(session, &run->buf);
+
+        __wt_spin_lock(session, &parallel->lock);
+        if (ret != 0 && parallel->ret == 0)
+            parallel->ret = ret;
+        ++parallel->runs_done;
+        __wt_spin_unlock(session, &parallel->lock);
+        __wt_cond_signal(session, parallel->done_cond);
+        ret = 0;
+    }
+
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __curbulk_run_queue --
+ *     Queue the run being filled to the parallel bulk-load worker threads.
+ */
+static int
+__curbulk_run_queue(WT_SESSION_IMPL *session, WT_BULK_PARALLEL *parallel)
+{
+    WT_BULK_RUN *run;
+    WT_DECL_RET;
+    uint32_t busy;
+
+    run = parallel->run;
+    parallel->run = NULL;
+
+    /*
+     * Bound the memory held by runs waiting to be reconciled: if the workers have fallen behind,
+     * wait for them to catch up before queuing another run.
+     */
+    for (;;) {
+        __wt_spin_lock(session, &parallel->lock);
+        busy = parallel->runs_next - parallel->runs_done;
+        ret = parallel->ret;
+        __wt_spin_unlock(session, &parallel->lock);
+        WT_ERR(ret);
+        if (busy < 2 * parallel->workers)
+            break;
+        __wt_cond_wait(session, parallel->done_cond, 10 * WT_THOUSAND, NULL);
+    }
+
+    __wt_spin_lock(session, &parallel->lock);
+    ret = __wt_realloc_def(
+      session, &parallel->runs_allocated, parallel->runs_next + 1, &parallel->runs);
+    if (ret == 0) {
+        parallel->runs[parallel->runs_next++] = run;
+        run = NULL;
+    }
+    __wt_spin_unlock(session, &parallel->lock);
+    WT_ERR(ret);
+
+    __wt_cond_signal(session, parallel->work_cond);
+
+err:
+    if (run != NULL) {
+        __wt_buf_free(session, &run->buf);
+        __wt_free(session, run);
+    }
+    return (ret);
+}
+
+/*
+ * __curbulk_parallel_insert --
+ *     Append a row-store key/value pair to the run being filled, queuing the run to the worker
+ *     threads once it's large enough.
+ */
+static int
+__curbulk_parallel_insert(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk)
+{
+    WT_BULK_PARALLEL *parallel;
+    WT_BULK_RUN *run;
+    WT_CURSOR *cursor;
+    size_t len;
+    uint8_t *p;
+
+    cursor = &cbulk->cbt.iface;
+    parallel = cbulk->parallel;
+
+    if ((run = parallel->run) == NULL) {
+        WT_RET(__wt_calloc_one(session, &run));
+        run->id = parallel->runs_next;
+        parallel->run = run;
+    }
+
+    len = __wt_vsize_uint(cursor->key.size) + cursor->key.size +
+      __wt_vsize_uint(cursor->value.size) + cursor->value.size;
+    WT_RET(__wt_buf_extend(session, &run->buf, run->buf.size + len));
+    p = (uint8_t *)run->buf.mem + run->buf.size;
+    WT_RET(__wt_vpack_uint(&p, 0, cursor->key.size));
+    if (cursor->key.size != 0)
+        memcpy(p, cursor->key.data, cursor->key.size);
+    p += cursor->key.size;
+    WT_RET(__wt_vpack_uint(&p, 0, cursor->value.size));
+    if (cursor->value.size != 0)
+        memcpy(p, cursor->value.data, cursor->value.size);
+    p += cursor->value.size;
+    run->buf.size = WT_PTRDIFF(p, run->buf.mem);
+    ++run->count;
+
+    if (run->buf.size >= parallel->run_max)
+        WT_RET(__curbulk_run_queue(session, parallel));
+    return (0);
+}
+
+/*
+ * __curbulk_parallel_init --
+ *     Start the parallel row-store bulk-load worker threads.
+ */
+static int
+__curbulk_parallel_init(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk, u_int workers)
+{
+    WT_BULK_PARALLEL *parallel;
+    WT_BULK_WORKER *worker;
+    u_int i;
+
+    WT_RET(__wt_calloc_one(session, &parallel));
+    cbulk->parallel = parallel;
+    parallel->cbulk = cbulk;
+    parallel->dhandle = session->dhandle;
+    parallel->run_max = (size_t)WT_BULK_RUN_PAGES * S2BT(session)->maxleafpage;
+
+    WT_RET(__wt_spin_init(session, &parallel->lock, "bulk-load runs"));
+    WT_RET(__wt_cond_alloc(session, "bulk-load work", &parallel->work_cond));
+    WT_RET(__wt_cond_alloc(session, "bulk-load done", &parallel->done_cond));
+
+    WT_RET(__wt_calloc_def(session, workers, &parallel->worker_list));
+    for (i = 0; i < workers; ++i) {
+        worker = &parallel->worker_list[i];
+        worker->parallel = parallel;
+        WT_RET(
+          __wt_open_internal_session(S2C(session), "bulk-load", false, 0, 0, &worker->session));
+        ++parallel->workers;
+        WT_RET(__wt_thread_create(session, &worker->tid, __curbulk_worker, worker));
+    }
+    return (0);
+}
+
+/*
+ * __curbulk_parallel_close --
+ *     Queue the last run, wait for the worker threads to reconcile everything queued, then merge
+ *     the leaf pages of each run, in key order, into the bulk cursor's reconciliation.
+ */
+static int
+__curbulk_parallel_close(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk)
+{
+    WT_BULK_PARALLEL *parallel;
+    WT_BULK_RUN *run;
+    WT_BULK_WORKER *worker;
+    WT_DECL_RET;
+    uint32_t i;
+
+    if ((parallel = cbulk->parallel) == NULL)
+        return (0);
+
+    if (parallel->run != NULL && parallel->workers != 0)
+        ret = __curbulk_run_queue(session, parallel);
+
+    if (parallel->work_cond != NULL) {
+        __wt_spin_lock(session, &parallel->lock);
+        parallel->closing = true;
+        __wt_spin_unlock(session, &parallel->lock);
+        __wt_cond_signal(session, parallel->work_cond);
+    }
+    for (i = 0; i < parallel->workers; ++i) {
+        worker = &parallel->worker_list[i];
+        WT_TRET(__wt_thread_join(session, &worker->tid));
+        WT_TRET(__wt_session_close_internal(worker->session));
+    }
+    if (ret == 0)
+        ret = parallel->ret;
+
+    /*
+     * Merge the runs even after a failure: the bulk cursor's reconciliation owns the written pages
+     * from then on and frees them when it's cleaned up.
+     */
+    for (i = 0; i < parallel->runs_next; ++i) {
+        run = parallel->runs[i];
+        WT_TRET(__wt_bulk_run_merge(session, cbulk, &run->multi, &run->multi_entries));
+        __wt_buf_free(session, &run->buf);
+        __wt_free(session, run);
+    }
+    WT_STAT_CONN_DSRC_INCRV(session, cursor_bulk_runs, parallel->runs_next);
+    if (parallel->run != NULL) {
+        __wt_buf_free(session, &parallel->run->buf);
+        __wt_free(session, parallel->run);
+    }
+
+    __wt_free(session, parallel->runs);
+    __wt_free(session, parallel->worker_list);
+    __wt_cond_destroy(session, &parallel->work_cond);
+    __wt_cond_destroy(session, &parallel->done_cond);
+    __wt_spin_destroy(session, &parallel->lock);
+    __wt_free(session, cbulk->parallel);
+    return (ret);
+}
+
 /*
  * __bulk_row_keycmp_err --
  *     Error routine when row-store keys inserted out-of-order.
@@ -253,7 +543,8 @@ __curbulk_insert_row(WT_CURSOR *cursor)
     /* Save a copy of the key for the next comparison. */
     WT_ERR(__wt_buf_set(session, cbulk->last, cursor->key.data, cursor->key.size));
 
-    ret = __wt_bulk_insert_row(session, cbulk);
+    ret = cbulk->parallel == NULL ? __wt_bulk_insert_row(session, cbulk) :
+                                    __curbulk_parallel_insert(session, cbulk);
 
 err:
     API_END_RET(session, ret);
@@ -284,7 +575,8 @@ __curbulk_insert_row_skip_check(WT_CURSOR *cursor)
     WT_ERR(__cursor_checkkey(cursor));
     WT_ERR(__cursor_checkvalue(cursor));
 
-    ret = __wt_bulk_insert_row(session, cbulk);
+    ret = cbulk->parallel == NULL ? __wt_bulk_insert_row(session, cbulk) :
+                                    __curbulk_parallel_insert(session, cbulk);
 
 err:
     API_END_RET(session, ret);
@@ -295,8 +587,8 @@ err:
  *     Initialize a bulk cursor.
  */
 int
-__wti_curbulk_init(
-  WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk, bool bitmap, bool skip_sort_check)
+__wti_curbulk_init(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk, bool bitmap,
+  bool skip_sort_check, u_int bulk_threads)
 {
     WT_CURSOR *cursor;
     WT_CURSOR_BTREE *cbt;
@@ -339,7 +631,15 @@ __wti_curbulk_init(
      */
     WT_RET(__wt_scr_alloc(session, 100, &cbulk->last));
 
-    return (__wt_bulk_init(session, cbulk));
+    WT_RET(__wt_bulk_init(session, cbulk));
+
+    /* Row-store leaf pages can optionally be built by a set of worker threads. */
+    if (bulk_threads != 0) {
+        if (CUR2BT(cbt)->type != BTREE_ROW)
+            WT_RET_MSG(session, ENOTSUP, "bulk_threads is only supported for row-store objects");
+        WT_RET(__curbulk_parallel_init(session, cbulk, bulk_threads));
+    }
+    return (0);
 }
 
 /*
@@ -351,7 +651,8 @@ __wti_curbulk_close(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk)
 {
     WT_DECL_RET;
 
-    ret = __wt_bulk_wrapup(session, cbulk);
+    ret = __curbulk_parallel_close(session, cbulk);
+    WT_TRET(__wt_bulk_wrapup(session, cbulk));
     if (ret == 0)
         WT_STAT_CONN_DECR_ATOMIC(session, cursor_bulk_count);
 
@@ -977,7 +977,7 @@ __curfile_create(WT_SESSION_IMPL *session, WT_CURSOR *owner, const char *cfg[],
     WT_CURSOR_BULK *cbulk;
     WT_DECL_RET;
     size_t csize;
-    bool cacheable;
+    bool cacheable, skip_sort_check;
 
     WT_VERIFY_OPAQUE_POINTER(WT_CURSOR_BTREE);
 
@@ -1026,7 +1026,12 @@ __curfile_create(WT_SESSION_IMPL *session, WT_CURSOR *owner, const char *cfg[],
 
         /* Optionally skip the validation of each bulk-loaded key. */
         WT_ERR(__wt_config_gets_def(session, cfg, "skip_sort_check", 0, &cval));
-        WT_ERR(__wti_curbulk_init(session, cbulk, bitmap, cval.val == 0 ? 0 : 1));
+        skip_sort_check = cval.val != 0;
+
+        /* Optionally build the leaf pages in parallel. */
+        WT_ERR(__wt_config_gets_def(session, cfg, "bulk_threads", 0, &cval));
+        WT_ERR(
+          __wti_curbulk_init(session, cbulk, bitmap, skip_sort_check, (u_int)cval.val));
     }
 
     /*
@@ -1547,13 +1547,13 @@ __evict_walk_choose_dhandle(WT_SESSION_IMPL *session, WT_DATA_HANDLE **dhandle_p
     } while ((dh_bucket_count = conn->dh_bucket_count[rnd_bucket]) == 0);
 
     /* We can't pick up an empty bucket with a non zero bucket count. */
-    WT_ASSERT(session, !TAILQ_EMPTY(&conn->dhhash[rnd_bucket]));
+    WT_ASSERT(session, conn->dhhash[rnd_bucket] != NULL);
 
     /* Pick a random dhandle in the chosen bucket. */
     rnd_dh = __wt_random(&session->rnd) % dh_bucket_count;
-    dhandle = TAILQ_FIRST(&conn->dhhash[rnd_bucket]);
+    dhandle = conn->dhhash[rnd_bucket];
     for (; rnd_dh > 0; rnd_dh--)
-        dhandle = TAILQ_NEXT(dhandle, hashq);
+        dhandle = dhandle->hash_next;
 #else
     /* Just step through dhandles. */
     dhandle = *dhandle_p;
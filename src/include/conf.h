@@ -155,7 +155,7 @@ WT_CONF_API_DECLARE(WT_SESSION, compact, 1, 6);
 WT_CONF_API_DECLARE(WT_SESSION, create, 6, 67);
 WT_CONF_API_DECLARE(WT_SESSION, drop, 1, 5);
 WT_CONF_API_DECLARE(WT_SESSION, log_flush, 1, 1);
-WT_CONF_API_DECLARE(WT_SESSION, open_cursor, 3, 29);
+WT_CONF_API_DECLARE(WT_SESSION, open_cursor, 3, 30);
 WT_CONF_API_DECLARE(WT_SESSION, prepare_transaction, 1, 1);
 WT_CONF_API_DECLARE(WT_SESSION, query_timestamp, 1, 1);
 WT_CONF_API_DECLARE(WT_SESSION, reconfigure, 3, 9);
@@ -171,10 +171,10 @@ WT_CONF_API_DECLARE(object, meta, 5, 64);
 WT_CONF_API_DECLARE(table, meta, 2, 13);
 WT_CONF_API_DECLARE(tier, meta, 5, 65);
 WT_CONF_API_DECLARE(tiered, meta, 5, 67);
-WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open, 23, 172);
-WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_all, 23, 173);
-WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_basecfg, 23, 167);
-WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_usercfg, 23, 166);
+WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open, 24, 174);
+WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_all, 24, 175);
+WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_basecfg, 24, 169);
+WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_usercfg, 24, 168);
 
 #define WT_CONF_API_ELEMENTS 52
 
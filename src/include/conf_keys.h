@@ -16,178 +16,180 @@
  * API configuration keys: BEGIN
  */
 #define WT_CONF_ID_Assert 1ULL
-#define WT_CONF_ID_Block_cache 154ULL
-#define WT_CONF_ID_Checkpoint 169ULL
-#define WT_CONF_ID_Checkpoint_cleanup 172ULL
-#define WT_CONF_ID_Chunk_cache 174ULL
-#define WT_CONF_ID_Compatibility 176ULL
-#define WT_CONF_ID_Debug 98ULL
-#define WT_CONF_ID_Debug_mode 178ULL
+#define WT_CONF_ID_Block_cache 155ULL
+#define WT_CONF_ID_Checkpoint 170ULL
+#define WT_CONF_ID_Checkpoint_cleanup 173ULL
+#define WT_CONF_ID_Chunk_cache 175ULL
+#define WT_CONF_ID_Compatibility 177ULL
+#define WT_CONF_ID_Debug 99ULL
+#define WT_CONF_ID_Debug_mode 179ULL
 #define WT_CONF_ID_Encryption 19ULL
-#define WT_CONF_ID_Eviction 197ULL
-#define WT_CONF_ID_File_manager 210ULL
-#define WT_CONF_ID_Flush_tier 143ULL
-#define WT_CONF_ID_Hash 273ULL
-#define WT_CONF_ID_Heuristic_controls 215ULL
-#define WT_CONF_ID_History_store 219ULL
+#define WT_CONF_ID_Eviction 198ULL
+#define WT_CONF_ID_File_manager 211ULL
+#define WT_CONF_ID_Flush_tier 144ULL
+#define WT_CONF_ID_Hash 274ULL
+#define WT_CONF_ID_Heuristic_controls 216ULL
+#define WT_CONF_ID_History_store 220ULL
 #define WT_CONF_ID_Import 84ULL
-#define WT_CONF_ID_Incremental 103ULL
-#define WT_CONF_ID_Io_capacity 221ULL
-#define WT_CONF_ID_Live_restore 278ULL
+#define WT_CONF_ID_Incremental 104ULL
+#define WT_CONF_ID_Io_capacity 222ULL
+#define WT_CONF_ID_Live_restore 279ULL
 #define WT_CONF_ID_Log 36ULL
-#define WT_CONF_ID_Operation_tracking 231ULL
-#define WT_CONF_ID_Prefetch 253ULL
-#define WT_CONF_ID_Rollback_to_stable 233ULL
-#define WT_CONF_ID_Roundup_timestamps 136ULL
-#define WT_CONF_ID_Shared_cache 235ULL
-#define WT_CONF_ID_Statistics_log 239ULL
+#define WT_CONF_ID_Operation_tracking 232ULL
+#define WT_CONF_ID_Prefetch 254ULL
+#define WT_CONF_ID_Reconcile 289ULL
+#define WT_CONF_ID_Rollback_to_stable 234ULL
+#define WT_CONF_ID_Roundup_timestamps 137ULL
+#define WT_CONF_ID_Shared_cache 236ULL
+#define WT_CONF_ID_Statistics_log 240ULL
 #define WT_CONF_ID_Tiered_storage 47ULL
-#define WT_CONF_ID_Transaction_sync 293ULL
+#define WT_CONF_ID_Transaction_sync 296ULL
 #define WT_CONF_ID_access_pattern_hint 12ULL
 #define WT_CONF_ID_action 73ULL
 #define WT_CONF_ID_allocation_size 13ULL
 #define WT_CONF_ID_app_metadata 0ULL
 #define WT_CONF_ID_append 70ULL
-#define WT_CONF_ID_archive 225ULL
+#define WT_CONF_ID_archive 226ULL
 #define WT_CONF_ID_auth_token 48ULL
-#define WT_CONF_ID_available 286ULL
+#define WT_CONF_ID_available 287ULL
 #define WT_CONF_ID_background 77ULL
-#define WT_CONF_ID_background_compact 179ULL
-#define WT_CONF_ID_backup 147ULL
-#define WT_CONF_ID_backup_restore_target 255ULL
-#define WT_CONF_ID_blkcache_eviction_aggression 157ULL
+#define WT_CONF_ID_background_compact 180ULL
+#define WT_CONF_ID_backup 148ULL
+#define WT_CONF_ID_backup_restore_target 256ULL
+#define WT_CONF_ID_blkcache_eviction_aggression 158ULL
 #define WT_CONF_ID_block_allocation 14ULL
 #define WT_CONF_ID_block_compressor 15ULL
 #define WT_CONF_ID_bound 74ULL
 #define WT_CONF_ID_bucket 49ULL
 #define WT_CONF_ID_bucket_prefix 50ULL
-#define WT_CONF_ID_buckets 274ULL
-#define WT_CONF_ID_buffer_alignment 256ULL
-#define WT_CONF_ID_builtin_extension_config 257ULL
+#define WT_CONF_ID_buckets 275ULL
+#define WT_CONF_ID_buffer_alignment 257ULL
+#define WT_CONF_ID_builtin_extension_config 258ULL
 #define WT_CONF_ID_bulk 96ULL
-#define WT_CONF_ID_cache 148ULL
-#define WT_CONF_ID_cache_cursors 249ULL
+#define WT_CONF_ID_bulk_threads 97ULL
+#define WT_CONF_ID_cache 149ULL
+#define WT_CONF_ID_cache_cursors 250ULL
 #define WT_CONF_ID_cache_directory 51ULL
-#define WT_CONF_ID_cache_max_wait_ms 165ULL
-#define WT_CONF_ID_cache_on_checkpoint 155ULL
-#define WT_CONF_ID_cache_on_writes 156ULL
-#define WT_CONF_ID_cache_overhead 166ULL
+#define WT_CONF_ID_cache_max_wait_ms 166ULL
+#define WT_CONF_ID_cache_on_checkpoint 156ULL
+#define WT_CONF_ID_cache_on_writes 157ULL
+#define WT_CONF_ID_cache_overhead 167ULL
 #define WT_CONF_ID_cache_resident 16ULL
-#define WT_CONF_ID_cache_size 167ULL
-#define WT_CONF_ID_cache_stuck_timeout_ms 168ULL
-#define WT_CONF_ID_capacity 259ULL
+#define WT_CONF_ID_cache_size 168ULL
+#define WT_CONF_ID_cache_stuck_timeout_ms 169ULL
+#define WT_CONF_ID_capacity 260ULL
 #define WT_CONF_ID_checkpoint 56ULL
 #define WT_CONF_ID_checkpoint_backup_info 57ULL
-#define WT_CONF_ID_checkpoint_cleanup 140ULL
-#define WT_CONF_ID_checkpoint_cleanup_obsolete_tw_pages_dirty_max 216ULL
-#define WT_CONF_ID_checkpoint_crash_point 141ULL
-#define WT_CONF_ID_checkpoint_fail_before_turtle_update 250ULL
+#define WT_CONF_ID_checkpoint_cleanup 141ULL
+#define WT_CONF_ID_checkpoint_cleanup_obsolete_tw_pages_dirty_max 217ULL
+#define WT_CONF_ID_checkpoint_crash_point 142ULL
+#define WT_CONF_ID_checkpoint_fail_before_turtle_update 251ULL
 #define WT_CONF_ID_checkpoint_lsn 58ULL
-#define WT_CONF_ID_checkpoint_read_timestamp 99ULL
-#define WT_CONF_ID_checkpoint_retention 181ULL
-#define WT_CONF_ID_checkpoint_sync 258ULL
-#define WT_CONF_ID_checkpoint_use_history 97ULL
+#define WT_CONF_ID_checkpoint_read_timestamp 100ULL
+#define WT_CONF_ID_checkpoint_retention 182ULL
+#define WT_CONF_ID_checkpoint_sync 259ULL
+#define WT_CONF_ID_checkpoint_use_history 98ULL
 #define WT_CONF_ID_checkpoint_wait 90ULL
 #define WT_CONF_ID_checksum 17ULL
-#define WT_CONF_ID_chunk 236ULL
-#define WT_CONF_ID_chunk_cache 223ULL
-#define WT_CONF_ID_chunk_cache_evict_trigger 260ULL
-#define WT_CONF_ID_chunk_size 261ULL
-#define WT_CONF_ID_close_handle_minimum 211ULL
-#define WT_CONF_ID_close_idle_time 212ULL
-#define WT_CONF_ID_close_scan_interval 213ULL
+#define WT_CONF_ID_chunk 237ULL
+#define WT_CONF_ID_chunk_cache 224ULL
+#define WT_CONF_ID_chunk_cache_evict_trigger 261ULL
+#define WT_CONF_ID_chunk_size 262ULL
+#define WT_CONF_ID_close_handle_minimum 212ULL
+#define WT_CONF_ID_close_idle_time 213ULL
+#define WT_CONF_ID_close_scan_interval 214ULL
 #define WT_CONF_ID_colgroups 66ULL
 #define WT_CONF_ID_collator 6ULL
 #define WT_CONF_ID_columns 7ULL
 #define WT_CONF_ID_commit_timestamp 2ULL
 #define WT_CONF_ID_compare_timestamp 85ULL
-#define WT_CONF_ID_compile_configuration_count 266ULL
-#define WT_CONF_ID_compressor 280ULL
-#define WT_CONF_ID_config 245ULL
-#define WT_CONF_ID_config_base 267ULL
-#define WT_CONF_ID_configuration 182ULL
-#define WT_CONF_ID_consolidate 104ULL
-#define WT_CONF_ID_corruption_abort 180ULL
-#define WT_CONF_ID_create 268ULL
-#define WT_CONF_ID_cursor_copy 183ULL
-#define WT_CONF_ID_cursor_reposition 184ULL
-#define WT_CONF_ID_cursors 149ULL
-#define WT_CONF_ID_default 287ULL
-#define WT_CONF_ID_dhandle_buckets 275ULL
+#define WT_CONF_ID_compile_configuration_count 267ULL
+#define WT_CONF_ID_compressor 281ULL
+#define WT_CONF_ID_config 246ULL
+#define WT_CONF_ID_config_base 268ULL
+#define WT_CONF_ID_configuration 183ULL
+#define WT_CONF_ID_consolidate 105ULL
+#define WT_CONF_ID_corruption_abort 181ULL
+#define WT_CONF_ID_create 269ULL
+#define WT_CONF_ID_cursor_copy 184ULL
+#define WT_CONF_ID_cursor_reposition 185ULL
+#define WT_CONF_ID_cursors 150ULL
+#define WT_CONF_ID_default 288ULL
+#define WT_CONF_ID_dhandle_buckets 276ULL
 #define WT_CONF_ID_dictionary 18ULL
-#define WT_CONF_ID_direct_io 269ULL
-#define WT_CONF_ID_do_not_clear_txn_id 119ULL
-#define WT_CONF_ID_drop 142ULL
+#define WT_CONF_ID_direct_io 270ULL
+#define WT_CONF_ID_do_not_clear_txn_id 120ULL
+#define WT_CONF_ID_drop 143ULL
 #define WT_CONF_ID_dryrun 78ULL
-#define WT_CONF_ID_dump 102ULL
-#define WT_CONF_ID_dump_address 120ULL
-#define WT_CONF_ID_dump_all_data 121ULL
-#define WT_CONF_ID_dump_blocks 122ULL
-#define WT_CONF_ID_dump_key_data 123ULL
-#define WT_CONF_ID_dump_layout 124ULL
-#define WT_CONF_ID_dump_offsets 125ULL
-#define WT_CONF_ID_dump_pages 126ULL
-#define WT_CONF_ID_dump_tree_shape 127ULL
-#define WT_CONF_ID_dump_version 100ULL
+#define WT_CONF_ID_dump 103ULL
+#define WT_CONF_ID_dump_address 121ULL
+#define WT_CONF_ID_dump_all_data 122ULL
+#define WT_CONF_ID_dump_blocks 123ULL
+#define WT_CONF_ID_dump_key_data 124ULL
+#define WT_CONF_ID_dump_layout 125ULL
+#define WT_CONF_ID_dump_offsets 126ULL
+#define WT_CONF_ID_dump_pages 127ULL
+#define WT_CONF_ID_dump_tree_shape 128ULL
+#define WT_CONF_ID_dump_version 101ULL
 #define WT_CONF_ID_durable_timestamp 3ULL
-#define WT_CONF_ID_early_load 246ULL
+#define WT_CONF_ID_early_load 247ULL
 #define WT_CONF_ID_enabled 37ULL
-#define WT_CONF_ID_entry 247ULL
-#define WT_CONF_ID_error_prefix 196ULL
-#define WT_CONF_ID_evict_sample_inmem 200ULL
-#define WT_CONF_ID_evict_use_softptr 201ULL
-#define WT_CONF_ID_eviction 185ULL
-#define WT_CONF_ID_eviction_checkpoint_target 202ULL
-#define WT_CONF_ID_eviction_checkpoint_ts_ordering 195ULL
-#define WT_CONF_ID_eviction_dirty_target 203ULL
-#define WT_CONF_ID_eviction_dirty_trigger 204ULL
-#define WT_CONF_ID_eviction_obsolete_tw_pages_dirty_max 217ULL
-#define WT_CONF_ID_eviction_target 205ULL
-#define WT_CONF_ID_eviction_trigger 206ULL
-#define WT_CONF_ID_eviction_updates_target 207ULL
-#define WT_CONF_ID_eviction_updates_trigger 208ULL
+#define WT_CONF_ID_entry 248ULL
+#define WT_CONF_ID_error_prefix 197ULL
+#define WT_CONF_ID_evict_sample_inmem 201ULL
+#define WT_CONF_ID_evict_use_softptr 202ULL
+#define WT_CONF_ID_eviction 186ULL
+#define WT_CONF_ID_eviction_checkpoint_target 203ULL
+#define WT_CONF_ID_eviction_checkpoint_ts_ordering 196ULL
+#define WT_CONF_ID_eviction_dirty_target 204ULL
+#define WT_CONF_ID_eviction_dirty_trigger 205ULL
+#define WT_CONF_ID_eviction_obsolete_tw_pages_dirty_max 218ULL
+#define WT_CONF_ID_eviction_target 206ULL
+#define WT_CONF_ID_eviction_trigger 207ULL
+#define WT_CONF_ID_eviction_updates_target 208ULL
+#define WT_CONF_ID_eviction_updates_trigger 209ULL
 #define WT_CONF_ID_exclude 79ULL
 #define WT_CONF_ID_exclusive 83ULL
 #define WT_CONF_ID_exclusive_refreshed 76ULL
-#define WT_CONF_ID_extensions 271ULL
-#define WT_CONF_ID_extra_diagnostics 209ULL
-#define WT_CONF_ID_file 105ULL
-#define WT_CONF_ID_file_extend 272ULL
-#define WT_CONF_ID_file_max 220ULL
+#define WT_CONF_ID_extensions 272ULL
+#define WT_CONF_ID_extra_diagnostics 210ULL
+#define WT_CONF_ID_file 106ULL
+#define WT_CONF_ID_file_extend 273ULL
+#define WT_CONF_ID_file_max 221ULL
 #define WT_CONF_ID_file_metadata 86ULL
-#define WT_CONF_ID_final_flush 145ULL
+#define WT_CONF_ID_final_flush 146ULL
 #define WT_CONF_ID_flush_time 64ULL
 #define WT_CONF_ID_flush_timestamp 65ULL
-#define WT_CONF_ID_flushed_data_cache_insertion 263ULL
+#define WT_CONF_ID_flushed_data_cache_insertion 264ULL
 #define WT_CONF_ID_force 91ULL
-#define WT_CONF_ID_force_stop 106ULL
-#define WT_CONF_ID_force_write_wait 281ULL
+#define WT_CONF_ID_force_stop 107ULL
+#define WT_CONF_ID_force_write_wait 282ULL
 #define WT_CONF_ID_format 22ULL
 #define WT_CONF_ID_free_space_target 80ULL
-#define WT_CONF_ID_full_target 158ULL
-#define WT_CONF_ID_generation_drain_timeout_ms 214ULL
-#define WT_CONF_ID_get 118ULL
-#define WT_CONF_ID_granularity 107ULL
-#define WT_CONF_ID_handles 150ULL
-#define WT_CONF_ID_hashsize 160ULL
-#define WT_CONF_ID_hazard_max 276ULL
+#define WT_CONF_ID_full_target 159ULL
+#define WT_CONF_ID_generation_drain_timeout_ms 215ULL
+#define WT_CONF_ID_get 119ULL
+#define WT_CONF_ID_granularity 108ULL
+#define WT_CONF_ID_handles 151ULL
+#define WT_CONF_ID_hashsize 161ULL
+#define WT_CONF_ID_hazard_max 277ULL
 #define WT_CONF_ID_huffman_key 23ULL
 #define WT_CONF_ID_huffman_value 24ULL
 #define WT_CONF_ID_id 59ULL
-#define WT_CONF_ID_ignore_cache_size 252ULL
+#define WT_CONF_ID_ignore_cache_size 253ULL
 #define WT_CONF_ID_ignore_in_memory_cache_size 25ULL
-#define WT_CONF_ID_ignore_prepare 131ULL
+#define WT_CONF_ID_ignore_prepare 132ULL
 #define WT_CONF_ID_immutable 63ULL
-#define WT_CONF_ID_in_memory 277ULL
+#define WT_CONF_ID_in_memory 278ULL
 #define WT_CONF_ID_inclusive 75ULL
 #define WT_CONF_ID_internal_item_max 26ULL
 #define WT_CONF_ID_internal_key_max 27ULL
 #define WT_CONF_ID_internal_key_truncate 28ULL
 #define WT_CONF_ID_internal_page_max 29ULL
-#define WT_CONF_ID_interval 292ULL
-#define WT_CONF_ID_isolation 132ULL
-#define WT_CONF_ID_json 240ULL
-#define WT_CONF_ID_json_output 224ULL
+#define WT_CONF_ID_interval 295ULL
+#define WT_CONF_ID_isolation 133ULL
+#define WT_CONF_ID_json 241ULL
+#define WT_CONF_ID_json_output 225ULL
 #define WT_CONF_ID_key_format 30ULL
 #define WT_CONF_ID_key_gap 31ULL
 #define WT_CONF_ID_keyid 21ULL
@@ -196,125 +198,126 @@
 #define WT_CONF_ID_leaf_key_max 33ULL
 #define WT_CONF_ID_leaf_page_max 34ULL
 #define WT_CONF_ID_leaf_value_max 35ULL
-#define WT_CONF_ID_leak_memory 146ULL
+#define WT_CONF_ID_leak_memory 147ULL
 #define WT_CONF_ID_local_retention 52ULL
 #define WT_CONF_ID_lock_wait 92ULL
-#define WT_CONF_ID_log 151ULL
-#define WT_CONF_ID_log_retention 186ULL
-#define WT_CONF_ID_log_size 170ULL
-#define WT_CONF_ID_max_percent_overhead 161ULL
+#define WT_CONF_ID_log 152ULL
+#define WT_CONF_ID_log_retention 187ULL
+#define WT_CONF_ID_log_size 171ULL
+#define WT_CONF_ID_max_percent_overhead 162ULL
 #define WT_CONF_ID_memory_page_image_max 38ULL
 #define WT_CONF_ID_memory_page_max 39ULL
 #define WT_CONF_ID_metadata_file 87ULL
-#define WT_CONF_ID_method 173ULL
-#define WT_CONF_ID_mmap 283ULL
-#define WT_CONF_ID_mmap_all 284ULL
-#define WT_CONF_ID_multiprocess 285ULL
+#define WT_CONF_ID_method 174ULL
+#define WT_CONF_ID_mmap 284ULL
+#define WT_CONF_ID_mmap_all 285ULL
+#define WT_CONF_ID_multiprocess 286ULL
 #define WT_CONF_ID_name 20ULL
-#define WT_CONF_ID_next_random 110ULL
-#define WT_CONF_ID_next_random_sample_size 111ULL
-#define WT_CONF_ID_next_random_seed 112ULL
-#define WT_CONF_ID_no_timestamp 133ULL
-#define WT_CONF_ID_nvram_path 162ULL
+#define WT_CONF_ID_next_random 111ULL
+#define WT_CONF_ID_next_random_sample_size 112ULL
+#define WT_CONF_ID_next_random_seed 113ULL
+#define WT_CONF_ID_no_timestamp 134ULL
+#define WT_CONF_ID_nvram_path 163ULL
 #define WT_CONF_ID_object_target_size 53ULL
-#define WT_CONF_ID_obsolete_tw_btree_max 218ULL
+#define WT_CONF_ID_obsolete_tw_btree_max 219ULL
 #define WT_CONF_ID_oldest 68ULL
-#define WT_CONF_ID_oldest_timestamp 254ULL
-#define WT_CONF_ID_on_close 241ULL
-#define WT_CONF_ID_operation_timeout_ms 134ULL
+#define WT_CONF_ID_oldest_timestamp 255ULL
+#define WT_CONF_ID_on_close 242ULL
+#define WT_CONF_ID_operation_timeout_ms 135ULL
 #define WT_CONF_ID_os_cache_dirty_max 40ULL
-#define WT_CONF_ID_os_cache_dirty_pct 226ULL
+#define WT_CONF_ID_os_cache_dirty_pct 227ULL
 #define WT_CONF_ID_os_cache_max 41ULL
 #define WT_CONF_ID_overwrite 71ULL
 #define WT_CONF_ID_panic_corrupt 88ULL
-#define WT_CONF_ID_path 232ULL
-#define WT_CONF_ID_percent_file_in_dram 163ULL
-#define WT_CONF_ID_pinned 175ULL
-#define WT_CONF_ID_prealloc 227ULL
-#define WT_CONF_ID_prealloc_init_count 228ULL
+#define WT_CONF_ID_path 233ULL
+#define WT_CONF_ID_percent_file_in_dram 164ULL
+#define WT_CONF_ID_pinned 176ULL
+#define WT_CONF_ID_prealloc 228ULL
+#define WT_CONF_ID_prealloc_init_count 229ULL
 #define WT_CONF_ID_prefix_compression 42ULL
 #define WT_CONF_ID_prefix_compression_min 43ULL
 #define WT_CONF_ID_prefix_search 72ULL
-#define WT_CONF_ID_prepare_timestamp 139ULL
-#define WT_CONF_ID_prepared 137ULL
-#define WT_CONF_ID_priority 135ULL
-#define WT_CONF_ID_quota 237ULL
-#define WT_CONF_ID_raw 113ULL
-#define WT_CONF_ID_read 138ULL
-#define WT_CONF_ID_read_corrupt 128ULL
-#define WT_CONF_ID_read_once 114ULL
-#define WT_CONF_ID_read_size 279ULL
+#define WT_CONF_ID_prepare_timestamp 140ULL
+#define WT_CONF_ID_prepared 138ULL
+#define WT_CONF_ID_priority 136ULL
+#define WT_CONF_ID_quota 238ULL
+#define WT_CONF_ID_raw 114ULL
+#define WT_CONF_ID_read 139ULL
+#define WT_CONF_ID_read_corrupt 129ULL
+#define WT_CONF_ID_read_once 115ULL
+#define WT_CONF_ID_read_size 280ULL
 #define WT_CONF_ID_read_timestamp 4ULL
 #define WT_CONF_ID_readonly 60ULL
-#define WT_CONF_ID_realloc_exact 187ULL
-#define WT_CONF_ID_realloc_malloc 188ULL
-#define WT_CONF_ID_recover 282ULL
-#define WT_CONF_ID_release 177ULL
-#define WT_CONF_ID_release_evict 101ULL
-#define WT_CONF_ID_release_evict_page 251ULL
-#define WT_CONF_ID_remove 229ULL
+#define WT_CONF_ID_realloc_exact 188ULL
+#define WT_CONF_ID_realloc_malloc 189ULL
+#define WT_CONF_ID_recover 283ULL
+#define WT_CONF_ID_release 178ULL
+#define WT_CONF_ID_release_evict 102ULL
+#define WT_CONF_ID_release_evict_page 252ULL
+#define WT_CONF_ID_remove 230ULL
 #define WT_CONF_ID_remove_files 93ULL
 #define WT_CONF_ID_remove_shared 94ULL
 #define WT_CONF_ID_repair 89ULL
-#define WT_CONF_ID_require_max 264ULL
-#define WT_CONF_ID_require_min 265ULL
-#define WT_CONF_ID_reserve 238ULL
-#define WT_CONF_ID_rollback_error 189ULL
+#define WT_CONF_ID_require_max 265ULL
+#define WT_CONF_ID_require_min 266ULL
+#define WT_CONF_ID_reserve 239ULL
+#define WT_CONF_ID_rollback_error 190ULL
 #define WT_CONF_ID_run_once 81ULL
-#define WT_CONF_ID_salvage 288ULL
-#define WT_CONF_ID_secretkey 270ULL
-#define WT_CONF_ID_session_max 289ULL
-#define WT_CONF_ID_session_scratch_max 290ULL
-#define WT_CONF_ID_session_table_cache 291ULL
-#define WT_CONF_ID_sessions 152ULL
+#define WT_CONF_ID_salvage 291ULL
+#define WT_CONF_ID_secretkey 271ULL
+#define WT_CONF_ID_session_max 292ULL
+#define WT_CONF_ID_session_scratch_max 293ULL
+#define WT_CONF_ID_session_table_cache 294ULL
+#define WT_CONF_ID_sessions 153ULL
 #define WT_CONF_ID_shared 54ULL
-#define WT_CONF_ID_size 159ULL
-#define WT_CONF_ID_skip_sort_check 115ULL
-#define WT_CONF_ID_slow_checkpoint 190ULL
+#define WT_CONF_ID_size 160ULL
+#define WT_CONF_ID_skip_sort_check 116ULL
+#define WT_CONF_ID_slow_checkpoint 191ULL
 #define WT_CONF_ID_source 8ULL
-#define WT_CONF_ID_sources 242ULL
+#define WT_CONF_ID_sources 243ULL
 #define WT_CONF_ID_split_deepen_min_child 44ULL
 #define WT_CONF_ID_split_deepen_per_child 45ULL
 #define WT_CONF_ID_split_pct 46ULL
-#define WT_CONF_ID_src_id 108ULL
-#define WT_CONF_ID_stable_timestamp 129ULL
-#define WT_CONF_ID_statistics 116ULL
-#define WT_CONF_ID_storage_path 262ULL
-#define WT_CONF_ID_stress_skiplist 191ULL
-#define WT_CONF_ID_strict 130ULL
+#define WT_CONF_ID_src_id 109ULL
+#define WT_CONF_ID_stable_timestamp 130ULL
+#define WT_CONF_ID_statistics 117ULL
+#define WT_CONF_ID_storage_path 263ULL
+#define WT_CONF_ID_stress_skiplist 192ULL
+#define WT_CONF_ID_strict 131ULL
 #define WT_CONF_ID_sync 95ULL
-#define WT_CONF_ID_system_ram 164ULL
-#define WT_CONF_ID_table_logging 192ULL
-#define WT_CONF_ID_target 117ULL
-#define WT_CONF_ID_terminate 248ULL
-#define WT_CONF_ID_this_id 109ULL
-#define WT_CONF_ID_threads 234ULL
-#define WT_CONF_ID_threads_max 198ULL
-#define WT_CONF_ID_threads_min 199ULL
-#define WT_CONF_ID_tiered_flush_error_continue 193ULL
+#define WT_CONF_ID_system_ram 165ULL
+#define WT_CONF_ID_table_logging 193ULL
+#define WT_CONF_ID_target 118ULL
+#define WT_CONF_ID_terminate 249ULL
+#define WT_CONF_ID_this_id 110ULL
+#define WT_CONF_ID_threads 235ULL
+#define WT_CONF_ID_threads_max 199ULL
+#define WT_CONF_ID_threads_min 200ULL
+#define WT_CONF_ID_tiered_flush_error_continue 194ULL
 #define WT_CONF_ID_tiered_object 61ULL
 #define WT_CONF_ID_tiers 69ULL
 #define WT_CONF_ID_timeout 82ULL
-#define WT_CONF_ID_timestamp 243ULL
-#define WT_CONF_ID_timing_stress_for_test 244ULL
-#define WT_CONF_ID_total 222ULL
-#define WT_CONF_ID_txn 153ULL
+#define WT_CONF_ID_timestamp 244ULL
+#define WT_CONF_ID_timing_stress_for_test 245ULL
+#define WT_CONF_ID_total 223ULL
+#define WT_CONF_ID_txn 154ULL
 #define WT_CONF_ID_type 9ULL
-#define WT_CONF_ID_update_restore_evict 194ULL
-#define WT_CONF_ID_use_environment 294ULL
-#define WT_CONF_ID_use_environment_priv 295ULL
-#define WT_CONF_ID_use_timestamp 144ULL
+#define WT_CONF_ID_update_restore_evict 195ULL
+#define WT_CONF_ID_use_environment 297ULL
+#define WT_CONF_ID_use_environment_priv 298ULL
+#define WT_CONF_ID_use_timestamp 145ULL
 #define WT_CONF_ID_value_format 55ULL
 #define WT_CONF_ID_verbose 10ULL
-#define WT_CONF_ID_verify_metadata 296ULL
+#define WT_CONF_ID_verify_metadata 299ULL
 #define WT_CONF_ID_version 62ULL
-#define WT_CONF_ID_wait 171ULL
-#define WT_CONF_ID_write_through 297ULL
+#define WT_CONF_ID_wait 172ULL
+#define WT_CONF_ID_write_threads 290ULL
+#define WT_CONF_ID_write_through 300ULL
 #define WT_CONF_ID_write_timestamp 5ULL
 #define WT_CONF_ID_write_timestamp_usage 11ULL
-#define WT_CONF_ID_zero_fill 230ULL
+#define WT_CONF_ID_zero_fill 231ULL
 
-#define WT_CONF_ID_COUNT 298
+#define WT_CONF_ID_COUNT 301
 /*
  * API configuration keys: END
  */
@@ -477,6 +480,9 @@ static const struct {
         uint64_t available;
         uint64_t _default;
     } Prefetch;
+    struct {
+      uint64_t write_threads;
+    } Reconcile;
     struct {
         uint64_t threads;
     } Rollback_to_stable;
@@ -529,6 +535,7 @@ static const struct {
     uint64_t buffer_alignment;
     uint64_t builtin_extension_config;
     uint64_t bulk;
+    uint64_t bulk_threads;
     uint64_t cache;
     uint64_t cache_cursors;
     uint64_t cache_directory;
@@ -833,6 +840,9 @@ static const struct {
     WT_CONF_ID_Prefetch | (WT_CONF_ID_default << 16),
   },
   {
+      WT_CONF_ID_Reconcile | (WT_CONF_ID_write_threads << 16),
+    },
+    {
     WT_CONF_ID_Rollback_to_stable | (WT_CONF_ID_threads << 16),
   },
   {
@@ -884,6 +894,7 @@ static const struct {
   WT_CONF_ID_buffer_alignment,
   WT_CONF_ID_builtin_extension_config,
   WT_CONF_ID_bulk,
+    WT_CONF_ID_bulk_threads,
   WT_CONF_ID_cache,
   WT_CONF_ID_cache_cursors,
   WT_CONF_ID_cache_directory,
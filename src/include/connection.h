@@ -258,6 +258,28 @@ struct __wt_name_flag {
     uint64_t flag;
 };
 
+/*
+ * WT_SWEEP_WHEEL --
+ *	A hierarchical timing wheel of data handles, keyed by the time (in seconds) the sweep server
+ *  next needs to look at each handle. Level 0 slots are one second wide, each higher level's slots
+ *  cover all of the slots of the level below it. Handles that are due are moved to the due queue.
+ */
+#define WT_SWEEP_WHEEL_BITS 6
+#define WT_SWEEP_WHEEL_LEVELS 4
+#define WT_SWEEP_WHEEL_SLOTS (1 << WT_SWEEP_WHEEL_BITS)
+#define WT_SWEEP_WHEEL_MASK (WT_SWEEP_WHEEL_SLOTS - 1)
+#define WT_SWEEP_WHEEL_RANGE ((uint64_t)1 << (WT_SWEEP_WHEEL_BITS * WT_SWEEP_WHEEL_LEVELS))
+struct __wt_sweep_wheel {
+    WT_SPINLOCK lock; /* Locked: everything in the wheel */
+
+    wt_shared uint64_t now; /* Time the wheel has advanced to, a coarse clock */
+
+    TAILQ_HEAD(__wt_sweep_qh, __wt_data_handle) slots[WT_SWEEP_WHEEL_LEVELS][WT_SWEEP_WHEEL_SLOTS];
+    struct __wt_sweep_qh due; /* Handles the sweep server must look at */
+
+    wt_shared bool rebuild; /* Reschedule every handle, the idle time changed */
+};
+
 /*
  * WT_CONN_CHECK_PANIC --
  *	Check if we've panicked and return the appropriate error.
@@ -273,7 +295,6 @@ struct __wt_name_flag {
     do {                                                                                         \
         WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_WRITE)); \
         TAILQ_INSERT_HEAD(&(conn)->dhqh, dhandle, q);                                            \
-        TAILQ_INSERT_HEAD(&(conn)->dhhash[bucket], dhandle, hashq);                              \
         ++(conn)->dh_bucket_count[bucket];                                                       \
         ++(conn)->dhandle_count;                                                                 \
         if (WT_DHANDLE_IS_CHECKPOINT(dhandle))                                                   \
@@ -286,7 +307,6 @@ struct __wt_name_flag {
     do {                                                                                         \
         WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_WRITE)); \
         TAILQ_REMOVE(&(conn)->dhqh, dhandle, q);                                                 \
-        TAILQ_REMOVE(&(conn)->dhhash[bucket], dhandle, hashq);                                   \
         --(conn)->dh_bucket_count[bucket];                                                       \
         --(conn)->dhandle_count;                                                                 \
         if (WT_DHANDLE_IS_CHECKPOINT(dhandle))                                                   \
@@ -439,11 +459,11 @@ struct __wt_connection_impl {
 
     /*
      * The connection keeps a cache of data handles. The set of handles can grow quite large so we
-     * maintain both a simple list and a hash table of lists. The hash table key is based on a hash
-     * of the table URI.
+     * maintain both a simple list and a hash table of singly-linked chains. The hash table key is
+     * based on a hash of the table URI. The chains are changed with the handle list write lock held
+     * but can be searched without any lock, see __wt_conn_dhandle_find_nolock.
      */
-    /* Locked: data handle hash array */
-    TAILQ_HEAD(__wt_dhhash, __wt_data_handle) * dhhash;
+    wt_shared WT_DATA_HANDLE **dhhash;
     /* Locked: data handle list */
     TAILQ_HEAD(__wt_dhandle_qh, __wt_data_handle) dhqh;
     /* Locked: dynamic library handle list */
@@ -458,9 +478,10 @@ struct __wt_connection_impl {
     TAILQ_HEAD(__wt_blockhash, __wt_block) * blockhash;
     TAILQ_HEAD(__wt_block_qh, __wt_block) blockqh;
 
-    WT_BLKCACHE blkcache;             /* Block cache */
-    WT_CHECKPOINT_CLEANUP cc_cleanup; /* Checkpoint cleanup */
-    WT_CHUNKCACHE chunkcache;         /* Chunk cache */
+    WT_BLKCACHE blkcache;               /* Block cache */
+    WT_CHECKPOINT_CLEANUP cc_cleanup;   /* Checkpoint cleanup */
+    WT_CHUNKCACHE chunkcache;           /* Chunk cache */
+    WT_META_CKPT_CACHE meta_ckpt_cache; /* Startup metadata checkpoint cache */
 
     uint64_t *dh_bucket_count;         /* Locked: handles in each bucket */
     uint64_t dhandle_count;            /* Locked: handles in the queue */
@@ -575,6 +596,12 @@ struct __wt_connection_impl {
     bool prefetch_auto_on;
     bool prefetch_available;
 
+    WT_SPINLOCK rec_write_lock;
+    WT_THREAD_GROUP rec_write_threads;
+    uint32_t rec_write_threads_num; /* Configured reconciliation write threads */
+    /* Queue of block images for the reconciliation write threads */
+    TAILQ_HEAD(__wt_rec_write_qh, __wt_rec_write_job) rwqh; /* Locked: rec_write_lock */
+
 #define WT_STATLOG_FILENAME "WiredTigerStat.%d.%H"
     WT_SESSION_IMPL *stat_session; /* Statistics log session */
     wt_thread_t stat_tid;          /* Statistics log thread */
@@ -623,6 +650,7 @@ struct __wt_connection_impl {
     uint64_t sweep_idle_time;       /* Handle sweep idle time */
     uint64_t sweep_interval;        /* Handle sweep interval */
     uint64_t sweep_handles_min;     /* Handle sweep minimum open */
+    WT_SWEEP_WHEEL sweep_wheel;     /* Handle sweep timing wheel */
 
     /* Locked: collator list */
     TAILQ_HEAD(__wt_coll_qh, __wt_named_collator) collqh;
@@ -812,10 +840,11 @@ struct __wt_connection_impl {
 #define WT_CONN_RECONFIGURING 0x01000000u
 #define WT_CONN_RECOVERING 0x02000000u
 #define WT_CONN_RECOVERY_COMPLETE 0x04000000u
-#define WT_CONN_RTS_THREAD_RUN 0x08000000u
-#define WT_CONN_SALVAGE 0x10000000u
-#define WT_CONN_TIERED_FIRST_FLUSH 0x20000000u
-#define WT_CONN_WAS_BACKUP 0x40000000u
+#define WT_CONN_REC_WRITE_RUN 0x08000000u
+#define WT_CONN_RTS_THREAD_RUN 0x10000000u
+#define WT_CONN_SALVAGE 0x20000000u
+#define WT_CONN_TIERED_FIRST_FLUSH 0x40000000u
+#define WT_CONN_WAS_BACKUP 0x80000000u
     /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
     wt_shared uint32_t flags;
 };
@@ -333,6 +333,68 @@ struct __wt_cursor_bulk {
     void *reconcile; /* Reconciliation support */
     WT_REF *ref;     /* The leaf page */
     WT_PAGE *leaf;
+
+    WT_BULK_PARALLEL *parallel; /* Parallel row-store bulk load */
+};
+
+/*
+ * WT_BULK_RUN_PAGES --
+ *     The target size of a parallel bulk-load run, in maximum-sized leaf pages.
+ */
+#define WT_BULK_RUN_PAGES 32
+
+/*
+ * WT_BULK_RUN --
+ *     A sorted run of row-store key/value pairs, reconciled into leaf pages by a bulk-load worker
+ *     thread.
+ */
+struct __wt_bulk_run {
+    uint32_t id;    /* Run position in the load */
+    WT_ITEM buf;    /* Packed key/value pairs */
+    uint64_t count; /* Key/value pairs in the run */
+
+    WT_MULTI *multi; /* Leaf pages written for the run */
+    uint32_t multi_entries;
+};
+
+/*
+ * WT_BULK_WORKER --
+ *     A parallel bulk-load worker thread.
+ */
+struct __wt_bulk_worker {
+    WT_BULK_PARALLEL *parallel;
+    WT_SESSION_IMPL *session; /* Worker session */
+    wt_thread_t tid;
+};
+
+/*
+ * WT_BULK_PARALLEL --
+ *     Parallel row-store bulk-load state: the application thread packs inserted rows into runs and
+ *     queues them to a set of internal worker threads, each of which reconciles a run into leaf
+ *     pages. The leaf pages are merged in run order when the cursor is closed.
+ */
+struct __wt_bulk_parallel {
+    WT_CURSOR_BULK *cbulk; /* Owning bulk cursor */
+    WT_DATA_HANDLE *dhandle;
+
+    WT_SPINLOCK lock;      /* Queue lock */
+    WT_CONDVAR *work_cond; /* Wake the worker threads */
+    WT_CONDVAR *done_cond; /* Wake the loading thread */
+
+    WT_BULK_RUN *run; /* Run being filled */
+    size_t run_max;   /* Run size threshold */
+
+    WT_BULK_RUN **runs; /* Queued runs, in key order */
+    size_t runs_allocated;
+    uint32_t runs_next;    /* Runs queued */
+    uint32_t runs_claimed; /* Runs claimed by a worker */
+    uint32_t runs_done;    /* Runs completed by a worker */
+
+    WT_BULK_WORKER *worker_list; /* Worker threads */
+    u_int workers;
+
+    volatile bool closing; /* No more runs will be queued */
+    int ret;               /* First worker error */
 };
 
 struct __wt_cursor_config {
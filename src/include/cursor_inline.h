@@ -393,12 +393,16 @@ __wt_cursor_dhandle_decr_use(WT_SESSION_IMPL *session)
     dhandle = session->dhandle;
 
     /*
-     * If we close a handle with a time of death set, clear it. The ordering is important: after
-     * decrementing the use count, there's a chance that the data handle can be freed.
+     * If we're closing the last use of the handle, set its time of death from the sweep server's
+     * coarse clock, the sweep server closes the handle once it has been idle long enough. The
+     * ordering is important: after decrementing the use count, there's a chance that the data
+     * handle can be freed.
      */
     WT_ASSERT(session, __wt_atomic_loadi32(&dhandle->session_inuse) > 0);
-    if (dhandle->timeofdeath != 0 && __wt_atomic_loadi32(&dhandle->session_inuse) == 1)
-        dhandle->timeofdeath = 0;
+    if (__wt_atomic_loadi32(&dhandle->session_inuse) == 1) {
+        dhandle->timeofdeath = __wt_atomic_load64(&S2C(session)->sweep_wheel.now);
+        WT_STAT_CONN_INCR(session, dh_sweep_tod);
+    }
     (void)__wt_atomic_subi32(&dhandle->session_inuse, 1);
 }
 
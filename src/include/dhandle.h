@@ -57,6 +57,19 @@
             WT_DHANDLE_ACQUIRE(dhandle);                                                   \
     } while (0)
 
+#define WT_DHANDLE_HASH_NEXT(session, dhandle, head)                                       \
+    do {                                                                                   \
+        WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST)); \
+        if ((dhandle) == NULL)                                                             \
+            (dhandle) = (head);                                                            \
+        else {                                                                             \
+            WT_DHANDLE_RELEASE(dhandle);                                                   \
+            (dhandle) = (dhandle)->hash_next;                                              \
+        }                                                                                  \
+        if ((dhandle) != NULL)                                                             \
+            WT_DHANDLE_ACQUIRE(dhandle);                                                   \
+    } while (0)
+
 #define WT_DHANDLE_IS_CHECKPOINT(dhandle) ((dhandle)->checkpoint != NULL)
 
 /*
@@ -88,7 +101,14 @@ enum wt_dhandle_type {
 struct __wt_data_handle {
     WT_RWLOCK rwlock; /* Lock for shared/exclusive ops */
     TAILQ_ENTRY(__wt_data_handle) q;
-    TAILQ_ENTRY(__wt_data_handle) hashq;
+
+    /*
+     * The connection's hash chain: searched without a lock inside a data handle generation, changed
+     * with the handle list write lock held. Removed handles are not freed until the generation
+     * drains, so a reader positioned on a removed handle can still follow its next pointer.
+     */
+    wt_shared struct __wt_data_handle *hash_next;
+    wt_shared bool hash_removed; /* Removal in progress, don't acquire */
 
     const char *name;           /* Object name as a URI */
     uint64_t name_hash;         /* Hash of name */
@@ -112,6 +132,11 @@ struct __wt_data_handle {
     uint64_t timeofdeath;            /* Use count went to 0 */
     WT_SESSION_IMPL *excl_session;   /* Session with exclusive use, if any */
 
+    /* Locked by the sweep wheel lock: the handle's position in the sweep timing wheel. */
+    TAILQ_ENTRY(__wt_data_handle) sweepq;
+    struct __wt_sweep_qh *sweep_head; /* Wheel slot holding the handle, or NULL */
+    uint64_t sweep_time;              /* Time sweep next looks at the handle */
+
     WT_DATA_SOURCE *dsrc; /* Data source for this handle */
     void *handle;         /* Generic handle */
 
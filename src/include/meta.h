@@ -97,3 +97,31 @@ struct __wt_blkincr {
                               /* AUTOMATIC FLAG VALUE GENERATION STOP 8 */
     uint8_t flags;
 };
+
+/*
+ * WT_META_CKPT_CACHE_ENTRY --
+ *	A btree object's metadata entry as read at startup, and its parsed last checkpoint.
+ */
+struct __wt_meta_ckpt_cache_entry {
+    char *uri;    /* Object URI */
+    char *config; /* Metadata configuration */
+
+    WT_CKPT ckpt; /* Last checkpoint */
+    int ckpt_ret; /* Return from parsing the last checkpoint */
+
+    wt_shared bool stale; /* Metadata updated since it was read */
+};
+
+/*
+ * WT_META_CKPT_CACHE --
+ *	Startup cache of the btree objects' metadata entries. Recovery reads the metadata once, in
+ * parallel key ranges, and parses each object's last checkpoint as it's read. Recovery, rollback to
+ * stable and btree opens then use the cache rather than searching the metadata and parsing the same
+ * entries again. The cache is discarded when recovery completes.
+ */
+struct __wt_meta_ckpt_cache {
+    WT_RWLOCK lock; /* Lookups and discard */
+
+    WT_META_CKPT_CACHE_ENTRY *entries; /* Entries, sorted by URI */
+    size_t entries_next;
+};
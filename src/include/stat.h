@@ -472,6 +472,7 @@ struct __wt_connection_stats {
     int64_t block_byte_map_read;
     int64_t block_remap_file_resize;
     int64_t block_remap_file_write;
+    int64_t block_preload_skipped;
     int64_t eviction_app_time;
     int64_t cache_read_app_count;
     int64_t cache_read_app_time;
@@ -746,6 +747,8 @@ struct __wt_connection_stats {
     int64_t memory_allocation;
     int64_t memory_free;
     int64_t memory_grow;
+    int64_t meta_ckpt_cache_hit;
+    int64_t meta_ckpt_cache_entries;
     int64_t no_session_sweep_5min;
     int64_t no_session_sweep_60min;
     int64_t cond_wait;
@@ -775,6 +778,7 @@ struct __wt_connection_stats {
     int64_t cursor_bounds_search_early_exit;
     int64_t cursor_bounds_search_near_repositioned_cursor;
     int64_t cursor_insert_bulk;
+    int64_t cursor_bulk_runs;
     int64_t cursor_cache_error;
     int64_t cursor_cache;
     int64_t cursor_close_error;
@@ -837,8 +841,10 @@ struct __wt_connection_stats {
     int64_t dh_conn_handle_checkpoint_count;
     int64_t dh_conn_handle_size;
     int64_t dh_conn_handle_count;
+    int64_t dh_conn_find_nolock;
     int64_t dh_sweep_ref;
     int64_t dh_sweep_dead_close;
+    int64_t dh_sweep_examined;
     int64_t dh_sweep_remove;
     int64_t dh_sweep_expired_close;
     int64_t dh_sweep_tod;
@@ -966,6 +972,8 @@ struct __wt_connection_stats {
     int64_t rec_vlcs_emptied_pages;
     int64_t rec_time_window_bytes_ts;
     int64_t rec_time_window_bytes_txn;
+    int64_t rec_write_queued;
+    int64_t rec_write_inline;
     int64_t rec_page_delete_fast;
     int64_t rec_overflow_key_leaf;
     int64_t rec_maximum_milliseconds;
@@ -992,6 +1000,7 @@ struct __wt_connection_stats {
     int64_t rec_time_window_pages_durable_stop_ts;
     int64_t rec_time_window_pages_stop_ts;
     int64_t rec_time_window_pages_stop_txn;
+    int64_t rec_write_wait;
     int64_t rec_time_window_prepared;
     int64_t rec_time_window_durable_start_ts;
     int64_t rec_time_window_start_ts;
@@ -1297,6 +1306,7 @@ struct __wt_dsrc_stats {
     int64_t cursor_reposition_failed;
     int64_t cursor_reposition;
     int64_t cursor_insert_bulk;
+    int64_t cursor_bulk_runs;
     int64_t cursor_reopen;
     int64_t cursor_cache;
     int64_t cursor_create;
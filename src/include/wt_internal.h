@@ -101,6 +101,12 @@ struct __wt_btree;
 typedef struct __wt_btree WT_BTREE;
 struct __wt_bucket_storage;
 typedef struct __wt_bucket_storage WT_BUCKET_STORAGE;
+struct __wt_bulk_parallel;
+typedef struct __wt_bulk_parallel WT_BULK_PARALLEL;
+struct __wt_bulk_run;
+typedef struct __wt_bulk_run WT_BULK_RUN;
+struct __wt_bulk_worker;
+typedef struct __wt_bulk_worker WT_BULK_WORKER;
 struct __wt_cache;
 typedef struct __wt_cache WT_CACHE;
 struct __wt_cache_pool;
@@ -273,6 +279,10 @@ struct __wt_log_record;
 typedef struct __wt_log_record WT_LOG_RECORD;
 struct __wt_log_thread;
 typedef struct __wt_log_thread WT_LOG_THREAD;
+struct __wt_meta_ckpt_cache;
+typedef struct __wt_meta_ckpt_cache WT_META_CKPT_CACHE;
+struct __wt_meta_ckpt_cache_entry;
+typedef struct __wt_meta_ckpt_cache_entry WT_META_CKPT_CACHE_ENTRY;
 struct __wt_multi;
 typedef struct __wt_multi WT_MULTI;
 struct __wt_name_flag;
@@ -313,6 +323,8 @@ struct __wt_prefetch_queue_entry;
 typedef struct __wt_prefetch_queue_entry WT_PREFETCH_QUEUE_ENTRY;
 struct __wt_process;
 typedef struct __wt_process WT_PROCESS;
+struct __wt_rec_write_job;
+typedef struct __wt_rec_write_job WT_REC_WRITE_JOB;
 struct __wt_reconcile;
 typedef struct __wt_reconcile WT_RECONCILE;
 struct __wt_reconcile_timeline;
@@ -357,6 +369,8 @@ struct __wt_stash;
 typedef struct __wt_stash WT_STASH;
 struct __wt_sweep_cookie;
 typedef struct __wt_sweep_cookie WT_SWEEP_COOKIE;
+struct __wt_sweep_wheel;
+typedef struct __wt_sweep_wheel WT_SWEEP_WHEEL;
 struct __wt_table;
 typedef struct __wt_table WT_TABLE;
 struct __wt_thread;
@@ -95,24 +95,18 @@ __ckpt_load_blk_mods(WT_SESSION_IMPL *session, const char *config, WT_CKPT *ckpt
 }
 
 /*
- * __wt_meta_checkpoint --
- *     Return a file's checkpoint information.
+ * __wti_meta_checkpoint_config --
+ *     Return a file's checkpoint information from its metadata configuration.
  */
 int
-__wt_meta_checkpoint(
-  WT_SESSION_IMPL *session, const char *fname, const char *checkpoint, WT_CKPT *ckpt)
+__wti_meta_checkpoint_config(WT_SESSION_IMPL *session, const char *fname, const char *config,
+  const char *checkpoint, WT_CKPT *ckpt)
 {
     WT_DECL_RET;
-    char *config;
-
-    config = NULL;
 
     /* Clear the returned information. */
     memset(ckpt, 0, sizeof(*ckpt));
 
-    /* Retrieve the metadata entry for the file. */
-    WT_ERR(__wt_metadata_search(session, fname, &config));
-
 /*
  * Check for the version mismatch in wiredtiger standalone build when compatibility has not been
  * configured.
@@ -120,10 +114,10 @@ __wt_meta_checkpoint(
 #ifdef WT_STANDALONE_BUILD
     if (!F_ISSET(S2C(session), WT_CONN_COMPATIBILITY))
         /* Check the major/minor version numbers. */
-        WT_ERR(__ckpt_version_chk(session, fname, config));
+        WT_RET(__ckpt_version_chk(session, fname, config));
 #else
     /* Check the major/minor version numbers. */
-    WT_ERR(__ckpt_version_chk(session, fname, config));
+    WT_RET(__ckpt_version_chk(session, fname, config));
 #endif
 
     /*
@@ -139,7 +133,34 @@ __wt_meta_checkpoint(
             ckpt->addr.size = ckpt->raw.size = 0;
         }
     } else
-        WT_ERR(__ckpt_named(session, checkpoint, config, ckpt));
+        ret = __ckpt_named(session, checkpoint, config, ckpt);
+
+    return (ret);
+}
+
+/*
+ * __wt_meta_checkpoint --
+ *     Return a file's checkpoint information.
+ */
+int
+__wt_meta_checkpoint(
+  WT_SESSION_IMPL *session, const char *fname, const char *checkpoint, WT_CKPT *ckpt)
+{
+    WT_DECL_RET;
+    char *config;
+
+    config = NULL;
+
+    /* Clear the returned information. */
+    memset(ckpt, 0, sizeof(*ckpt));
+
+    /* At startup, the file's last checkpoint may have been parsed as the metadata was read. */
+    if (checkpoint == NULL && (ret = __wt_meta_ckpt_cache_get(session, fname, ckpt)) != WT_NOTFOUND)
+        return (ret);
+
+    /* Retrieve the metadata entry for the file. */
+    WT_ERR(__wt_metadata_search(session, fname, &config));
+    ret = __wti_meta_checkpoint_config(session, fname, config, checkpoint, ckpt);
 
 err:
     __wt_free(session, config);
@@ -1022,6 +1043,22 @@ __ckpt_load(WT_SESSION_IMPL *session, WT_CONFIG_ITEM *k, WT_CONFIG_ITEM *v, WT_C
     return (0);
 }
 
+/*
+ * __wt_meta_update_connection_ckpt --
+ *     Update the connection's base write generation and most recent checkpoint time from a file's
+ *     last checkpoint.
+ */
+void
+__wt_meta_update_connection_ckpt(WT_SESSION_IMPL *session, const WT_CKPT *ckpt)
+{
+    WT_CONNECTION_IMPL *conn;
+
+    conn = S2C(session);
+
+    conn->base_write_gen = WT_MAX(ckpt->write_gen + 1, conn->base_write_gen);
+    conn->ckpt.most_recent = WT_MAX(ckpt->sec, conn->ckpt.most_recent);
+}
+
 /*
  * __wt_meta_update_connection --
  *     Update the connection's base write generation and most recent checkpoint time from the config
@@ -1031,15 +1068,12 @@ int
 __wt_meta_update_connection(WT_SESSION_IMPL *session, const char *config)
 {
     WT_CKPT ckpt;
-    WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
 
-    conn = S2C(session);
     memset(&ckpt, 0, sizeof(ckpt));
 
     if ((ret = __ckpt_last(session, config, &ckpt)) == 0) {
-        conn->base_write_gen = WT_MAX(ckpt.write_gen + 1, conn->base_write_gen);
-        conn->ckpt.most_recent = WT_MAX(ckpt.sec, conn->ckpt.most_recent);
+        __wt_meta_update_connection_ckpt(session, &ckpt);
         __wt_checkpoint_free(session, &ckpt);
     } else
         WT_RET_NOTFOUND_OK(ret);
@@ -0,0 +1,454 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Loading the startup metadata checkpoint cache: each worker reads a range of the metadata's keys
+ * and parses the last checkpoint of every btree object in its range.
+ */
+typedef struct {
+    WT_SESSION_IMPL *session; /* Worker session */
+    wt_thread_t tid;
+
+    char *start, *stop; /* Key range [start, stop), NULL if unbounded */
+
+    WT_META_CKPT_CACHE_ENTRY *entries; /* Entries read, sorted by URI */
+    size_t entries_allocated;
+    size_t entries_next;
+
+    int ret; /* Worker return */
+} WT_META_CKPT_CACHE_WORKER;
+
+/*
+ * __meta_ckpt_cache_handle_error --
+ *     Discard errors while loading the cache. If an entry can't be parsed, it isn't cached, and the
+ *     error is reported if the object is opened. If the cache can't be loaded, the metadata is read
+ *     as if there was no cache.
+ */
+static int
+__meta_ckpt_cache_handle_error(
+  WT_EVENT_HANDLER *handler, WT_SESSION *wt_session, int error, const char *message)
+{
+    WT_UNUSED(handler);
+    WT_UNUSED(wt_session);
+    WT_UNUSED(error);
+    WT_UNUSED(message);
+    return (0);
+}
+
+static WT_EVENT_HANDLER __meta_ckpt_cache_event_handler = {
+  __meta_ckpt_cache_handle_error, NULL, NULL, NULL, NULL};
+
+/*
+ * __meta_ckpt_cache_entry_free --
+ *     Free a cache entry.
+ */
+static void
+__meta_ckpt_cache_entry_free(WT_SESSION_IMPL *session, WT_META_CKPT_CACHE_ENTRY *entry)
+{
+    __wt_free(session, entry->uri);
+    __wt_free(session, entry->config);
+    __wt_checkpoint_free(session, &entry->ckpt);
+}
+
+/*
+ * __meta_ckpt_cache_read --
+ *     Read the btree objects' entries in a range of the metadata, parsing each object's last
+ *     checkpoint.
+ */
+static int
+__meta_ckpt_cache_read(WT_META_CKPT_CACHE_WORKER *worker)
+{
+    WT_CURSOR *cursor;
+    WT_DECL_RET;
+    WT_META_CKPT_CACHE_ENTRY *entry;
+    WT_SESSION_IMPL *session;
+    int cmp;
+    const char *config, *uri;
+
+    session = worker->session;
+
+    WT_RET(__wt_metadata_cursor(session, &cursor));
+    if (worker->start == NULL)
+        ret = cursor->next(cursor);
+    else {
+        cursor->set_key(cursor, worker->start);
+        if ((ret = cursor->search_near(cursor, &cmp)) == 0 && cmp < 0)
+            ret = cursor->next(cursor);
+    }
+    for (; ret == 0; ret = cursor->next(cursor)) {
+        WT_ERR(cursor->get_key(cursor, &uri));
+        if (worker->stop != NULL && strcmp(uri, worker->stop) >= 0)
+            break;
+        if (!WT_BTREE_PREFIX(uri) || strcmp(uri, WT_METAFILE_URI) == 0)
+            continue;
+        WT_ERR(cursor->get_value(cursor, &config));
+
+        WT_ERR(__wt_realloc_def(
+          session, &worker->entries_allocated, worker->entries_next + 1, &worker->entries));
+        entry = &worker->entries[worker->entries_next++];
+        WT_ERR(__wt_strdup(session, uri, &entry->uri));
+        WT_ERR(__wt_strdup(session, config, &entry->config));
+        entry->ckpt_ret = __wti_meta_checkpoint_config(session, uri, config, NULL, &entry->ckpt);
+    }
+    WT_ERR_NOTFOUND_OK(ret, false);
+
+err:
+    WT_TRET(__wt_metadata_cursor_release(session, &cursor));
+    return (ret);
+}
+
+/*
+ * __meta_ckpt_cache_worker --
+ *     Thread to read a range of the metadata into the cache.
+ */
+static WT_THREAD_RET
+__meta_ckpt_cache_worker(void *arg)
+{
+    WT_META_CKPT_CACHE_WORKER *worker;
+
+    worker = (WT_META_CKPT_CACHE_WORKER *)arg;
+    worker->ret = __meta_ckpt_cache_read(worker);
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __meta_ckpt_cache_key_add --
+ *     Append a copy of an internal page key to the range boundaries.
+ */
+static int
+__meta_ckpt_cache_key_add(WT_SESSION_IMPL *session, WT_PAGE *page, WT_REF *ref, char ***keysp,
+  size_t *allocatedp, size_t *nkeysp)
+{
+    size_t size;
+    const void *key;
+
+    __wt_ref_key(page, ref, &key, &size);
+    WT_RET(__wt_realloc_def(session, allocatedp, *nkeysp + 1, keysp));
+    WT_RET(__wt_strndup(session, key, size, &(*keysp)[*nkeysp]));
+    ++*nkeysp;
+    return (0);
+}
+
+/*
+ * __meta_ckpt_cache_keys --
+ *     Gather the keys of the metadata's root page as range boundaries. If there are fewer keys than
+ *     workers, also gather the keys of the root's children. The first key on an internal page
+ *     sorts before any key and isn't a boundary.
+ */
+static int
+__meta_ckpt_cache_keys(
+  WT_SESSION_IMPL *session, u_int nworkers, char ***keysp, size_t *allocatedp, size_t *nkeysp)
+{
+    WT_DECL_RET;
+    WT_PAGE *child, *root;
+    WT_PAGE_INDEX *cindex, *pindex;
+    WT_REF *ref;
+    uint32_t i, j;
+    bool descend;
+
+    root = S2BT(session)->root.page;
+    if (root == NULL || root->type != WT_PAGE_ROW_INT)
+        return (0);
+
+    WT_INTL_INDEX_GET(session, root, pindex);
+    descend = pindex->entries < nworkers;
+    for (i = 0; i < pindex->entries; ++i) {
+        ref = pindex->index[i];
+        if (i != 0)
+            WT_RET(__meta_ckpt_cache_key_add(session, root, ref, keysp, allocatedp, nkeysp));
+        if (!descend || !F_ISSET(ref, WT_REF_FLAG_INTERNAL))
+            continue;
+
+        WT_RET(__wt_page_in(session, ref, WT_READ_NO_SPLIT));
+        child = ref->page;
+        WT_INTL_INDEX_GET(session, child, cindex);
+        for (j = 1; j < cindex->entries && ret == 0; ++j)
+            ret = __meta_ckpt_cache_key_add(
+              session, child, cindex->index[j], keysp, allocatedp, nkeysp);
+        WT_TRET(__wt_page_release(session, ref, 0));
+        WT_RET(ret);
+    }
+    return (0);
+}
+
+/*
+ * __meta_ckpt_cache_ranges --
+ *     Split the metadata into key ranges for the workers, using the keys of the metadata's upper
+ *     internal pages. Returns the number of ranges, which may be fewer than the number of workers.
+ */
+static int
+__meta_ckpt_cache_ranges(
+  WT_SESSION_IMPL *session, WT_META_CKPT_CACHE_WORKER *workers, u_int nworkers, u_int *nrangesp)
+{
+    WT_CURSOR *cursor;
+    WT_DECL_RET;
+    size_t keys_allocated, nkeys;
+    u_int i, nranges;
+    char **keys;
+
+    *nrangesp = 1;
+    if (nworkers == 1)
+        return (0);
+
+    keys = NULL;
+    keys_allocated = nkeys = 0;
+    WT_RET(__wt_metadata_cursor(session, &cursor));
+    WT_WITH_BTREE(session, CUR2BT(cursor),
+      WT_WITH_PAGE_INDEX(
+        session, ret = __meta_ckpt_cache_keys(session, nworkers, &keys, &keys_allocated, &nkeys)));
+    WT_ERR(ret);
+
+    /* The boundaries split the keys into one more range than there are boundaries. */
+    nranges = (u_int)WT_MIN(nworkers, nkeys + 1);
+    for (i = 1; i < nranges; ++i) {
+        WT_ERR(__wt_strdup(session, keys[(nkeys * i) / nranges], &workers[i].start));
+        WT_ERR(__wt_strdup(session, workers[i].start, &workers[i - 1].stop));
+    }
+    *nrangesp = nranges;
+
+err:
+    WT_TRET(__wt_metadata_cursor_release(session, &cursor));
+    for (; nkeys > 0; --nkeys)
+        __wt_free(session, keys[nkeys - 1]);
+    __wt_free(session, keys);
+    return (ret);
+}
+
+/*
+ * __wt_meta_ckpt_cache_load --
+ *     Read the btree objects' metadata entries into the startup cache, using up to the given number
+ *     of threads. Failing to load the cache isn't an error, the metadata is then read as if there
+ *     was no cache.
+ */
+int
+__wt_meta_ckpt_cache_load(WT_SESSION_IMPL *session, u_int threads)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_META_CKPT_CACHE *cache;
+    WT_META_CKPT_CACHE_WORKER *worker, *workers;
+    size_t entries;
+    u_int i, nranges, nworkers;
+
+    conn = S2C(session);
+    cache = &conn->meta_ckpt_cache;
+    nranges = 0;
+
+    /* Discard any cache from an earlier pass. */
+    __wt_meta_ckpt_cache_discard(session);
+
+    nworkers = WT_MAX(threads, 1);
+    WT_RET(__wt_calloc_def(session, nworkers, &workers));
+    for (i = 0; i < nworkers; ++i) {
+        worker = &workers[i];
+        WT_ERR(__wt_open_internal_session(conn, "meta-ckpt-cache", false, 0, 0, &worker->session));
+        __wt_event_handler_set(worker->session, &__meta_ckpt_cache_event_handler);
+    }
+
+    WT_ERR(__meta_ckpt_cache_ranges(session, workers, nworkers, &nranges));
+
+    /* Read the ranges in parallel, or directly if there's only one. */
+    if (nranges == 1)
+        workers[0].ret = __meta_ckpt_cache_read(&workers[0]);
+    else {
+        for (i = 0; i < nranges; ++i)
+            WT_ERR(__wt_thread_create(
+              session, &workers[i].tid, __meta_ckpt_cache_worker, &workers[i]));
+        for (i = 0; i < nranges; ++i)
+            WT_TRET(__wt_thread_join(session, &workers[i].tid));
+        WT_ERR(ret);
+    }
+
+    /* The ranges are in key order: concatenate the workers' entries. */
+    for (entries = 0, i = 0; i < nranges; ++i) {
+        WT_ERR(workers[i].ret);
+        entries += workers[i].entries_next;
+    }
+    __wt_writelock(session, &cache->lock);
+    if ((ret = __wt_calloc_def(session, WT_MAX(entries, 1), &cache->entries)) == 0) {
+        for (i = 0; i < nranges; ++i) {
+            worker = &workers[i];
+            if (worker->entries_next == 0)
+                continue;
+            memcpy(cache->entries + cache->entries_next, worker->entries,
+              worker->entries_next * sizeof(*worker->entries));
+            cache->entries_next += worker->entries_next;
+            worker->entries_next = 0;
+        }
+        WT_STAT_CONN_INCRV(session, meta_ckpt_cache_entries, cache->entries_next);
+    }
+    __wt_writeunlock(session, &cache->lock);
+
+err:
+    for (i = 0; i < nworkers; ++i) {
+        worker = &workers[i];
+        if (nranges > 1)
+            WT_TRET(__wt_thread_join(session, &worker->tid));
+        for (; worker->entries_next > 0; --worker->entries_next)
+            __meta_ckpt_cache_entry_free(session, &worker->entries[worker->entries_next - 1]);
+        __wt_free(session, worker->entries);
+        __wt_free(session, worker->start);
+        __wt_free(session, worker->stop);
+        if (worker->session != NULL)
+            WT_TRET(__wt_session_close_internal(worker->session));
+    }
+    __wt_free(session, workers);
+
+    if (ret != 0 && ret != WT_PANIC) {
+        __wt_verbose_warning(session, WT_VERB_METADATA, "metadata checkpoint cache not loaded: %s",
+          __wt_strerror(session, ret, NULL, 0));
+        __wt_meta_ckpt_cache_discard(session);
+        ret = 0;
+    }
+    return (ret);
+}
+
+/*
+ * __wt_meta_ckpt_cache_discard --
+ *     Discard the startup cache.
+ */
+void
+__wt_meta_ckpt_cache_discard(WT_SESSION_IMPL *session)
+{
+    WT_META_CKPT_CACHE *cache;
+    size_t i;
+
+    cache = &S2C(session)->meta_ckpt_cache;
+
+    __wt_writelock(session, &cache->lock);
+    for (i = 0; i < cache->entries_next; ++i)
+        __meta_ckpt_cache_entry_free(session, &cache->entries[i]);
+    __wt_free(session, cache->entries);
+    cache->entries_next = 0;
+    __wt_writeunlock(session, &cache->lock);
+}
+
+/*
+ * __meta_ckpt_cache_search --
+ *     Binary search the cache for a URI. Called with the cache locked.
+ */
+static WT_META_CKPT_CACHE_ENTRY *
+__meta_ckpt_cache_search(WT_META_CKPT_CACHE *cache, const char *uri)
+{
+    WT_META_CKPT_CACHE_ENTRY *entry;
+    size_t base, indx, limit;
+    int cmp;
+
+    for (base = 0, limit = cache->entries_next; limit != 0; limit >>= 1) {
+        indx = base + (limit >> 1);
+        entry = &cache->entries[indx];
+        if ((cmp = strcmp(uri, entry->uri)) == 0)
+            return (entry);
+        if (cmp > 0) {
+            base = indx + 1;
+            --limit;
+        }
+    }
+    return (NULL);
+}
+
+/*
+ * __wt_meta_ckpt_cache_get --
+ *     Return a file's last checkpoint from the startup cache, or WT_NOTFOUND if it isn't cached.
+ */
+int
+__wt_meta_ckpt_cache_get(WT_SESSION_IMPL *session, const char *uri, WT_CKPT *ckpt)
+{
+    WT_DECL_RET;
+    WT_META_CKPT_CACHE *cache;
+    WT_META_CKPT_CACHE_ENTRY *entry;
+    WT_CKPT *src;
+
+    cache = &S2C(session)->meta_ckpt_cache;
+    ret = WT_NOTFOUND;
+
+    __wt_readlock(session, &cache->lock);
+    if (cache->entries != NULL && (entry = __meta_ckpt_cache_search(cache, uri)) != NULL &&
+      entry->ckpt_ret == 0 && !__wt_atomic_loadbool(&entry->stale)) {
+        /* Copy the checkpoint, pointing the copy at its own memory. */
+        src = &entry->ckpt;
+        *ckpt = *src;
+        ckpt->name = NULL;
+        WT_CLEAR(ckpt->addr);
+        WT_CLEAR(ckpt->raw);
+        if ((ret = __wt_strdup(session, src->name, &ckpt->name)) == 0 && src->addr.data != NULL)
+            ret = __wt_buf_set(session, &ckpt->addr, src->addr.data, src->addr.size);
+        if (ret == 0 && src->raw.data != NULL)
+            ret = __wt_buf_set(session, &ckpt->raw, src->raw.data, src->raw.size);
+        if (ret == 0)
+            WT_STAT_CONN_INCR(session, meta_ckpt_cache_hit);
+        else
+            __wt_checkpoint_free(session, ckpt);
+    }
+    __wt_readunlock(session, &cache->lock);
+    return (ret);
+}
+
+/*
+ * __wt_meta_ckpt_cache_invalidate --
+ *     The metadata for a URI is changing, stop using the cached entry.
+ */
+void
+__wt_meta_ckpt_cache_invalidate(WT_SESSION_IMPL *session, const char *uri)
+{
+    WT_META_CKPT_CACHE *cache;
+    WT_META_CKPT_CACHE_ENTRY *entry;
+
+    cache = &S2C(session)->meta_ckpt_cache;
+
+    __wt_readlock(session, &cache->lock);
+    if (cache->entries != NULL && (entry = __meta_ckpt_cache_search(cache, uri)) != NULL)
+        __wt_atomic_storebool(&entry->stale, true);
+    __wt_readunlock(session, &cache->lock);
+}
+
+/*
+ * __wt_meta_ckpt_cache_apply --
+ *     Call a function with the URI, metadata configuration and last checkpoint of each btree object
+ *     in the startup cache matching a prefix, in URI order. The checkpoint is NULL if it couldn't be
+ *     parsed or the metadata has changed since it was read. Returns WT_NOTFOUND if the cache isn't
+ *     loaded. Only the thread that loads and discards the cache may walk it.
+ */
+int
+__wt_meta_ckpt_cache_apply(WT_SESSION_IMPL *session, const char *prefix,
+  int (*func)(WT_SESSION_IMPL *, const char *, const char *, const WT_CKPT *, void *),
+  void *cookie)
+{
+    WT_DECL_RET;
+    WT_META_CKPT_CACHE *cache;
+    WT_META_CKPT_CACHE_ENTRY *entry;
+    size_t i;
+    char *config;
+
+    cache = &S2C(session)->meta_ckpt_cache;
+
+    if (cache->entries == NULL)
+        return (WT_NOTFOUND);
+
+    for (i = 0; i < cache->entries_next; ++i) {
+        entry = &cache->entries[i];
+        if (prefix != NULL && !WT_PREFIX_MATCH(entry->uri, prefix))
+            continue;
+
+        /* If the metadata has changed since it was read, read it again. */
+        if (!__wt_atomic_loadbool(&entry->stale)) {
+            WT_RET(func(session, entry->uri, entry->config,
+              entry->ckpt_ret == 0 ? &entry->ckpt : NULL, cookie));
+            continue;
+        }
+        if ((ret = __wt_metadata_search(session, entry->uri, &config)) == WT_NOTFOUND)
+            continue;
+        WT_RET(ret);
+        ret = func(session, entry->uri, config, NULL, cookie);
+        __wt_free(session, config);
+        WT_RET(ret);
+    }
+    return (0);
+}
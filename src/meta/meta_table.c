@@ -192,6 +192,8 @@ __wt_metadata_insert(WT_SESSION_IMPL *session, const char *key, const char *valu
     if (__metadata_turtle(key))
         WT_RET_MSG(session, EINVAL, "%s: insert not supported on the turtle file", key);
 
+    __wt_meta_ckpt_cache_invalidate(session, key);
+
     WT_RET(__wt_metadata_cursor(session, &cursor));
     cursor->set_key(cursor, key);
     cursor->set_value(cursor, value);
@@ -227,6 +229,8 @@ __wt_metadata_update(WT_SESSION_IMPL *session, const char *key, const char *valu
     if (WT_META_TRACKING(session))
         WT_RET(__wti_meta_track_update(session, key));
 
+    __wt_meta_ckpt_cache_invalidate(session, key);
+
     WT_RET(__wt_metadata_cursor(session, &cursor));
     /* This cursor needs to have overwrite semantics. */
     WT_ASSERT(session, F_ISSET(cursor, WT_CURSTD_OVERWRITE));
@@ -270,6 +274,8 @@ __wt_metadata_remove(WT_SESSION_IMPL *session, const char *key)
     if (WT_META_TRACKING(session))
         WT_ERR(__wti_meta_track_update(session, key));
 
+    __wt_meta_ckpt_cache_invalidate(session, key);
+
     WT_ERR(__wt_metadata_cursor(session, &cursor));
     cursor->set_key(cursor, key);
     ret = cursor->remove(cursor);
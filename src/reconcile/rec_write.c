@@ -17,6 +17,7 @@ static int __rec_root_write(WT_SESSION_IMPL *, WT_PAGE *, uint32_t);
 static int __rec_split_discard(WT_SESSION_IMPL *, WT_PAGE *);
 static int __rec_split_row_promote(WT_SESSION_IMPL *, WT_RECONCILE *, WT_ITEM *, uint8_t);
 static int __rec_split_write(WT_SESSION_IMPL *, WT_RECONCILE *, WTI_REC_CHUNK *, WT_ITEM *, bool);
+static int __rec_split_write_collect(WT_SESSION_IMPL *, WT_RECONCILE *);
 static void __rec_write_page_status(WT_SESSION_IMPL *, WT_RECONCILE *);
 static int __rec_write_err(WT_SESSION_IMPL *, WT_RECONCILE *, WT_PAGE *);
 static int __rec_write_wrapup(WT_SESSION_IMPL *, WT_RECONCILE *, WT_PAGE *);
@@ -775,11 +776,15 @@ static int
 __rec_cleanup(WT_SESSION_IMPL *session, WT_RECONCILE *r)
 {
     WT_BTREE *btree;
+    WT_DECL_RET;
     WT_MULTI *multi;
     uint32_t i;
 
     btree = S2BT(session);
 
+    /* Blocks still with the write threads reference this structure, wait for them. */
+    ret = __rec_split_write_collect(session, r);
+
     if (r->hs_cursor != NULL)
         WT_RET(r->hs_cursor->reset(r->hs_cursor));
 
@@ -796,7 +801,7 @@ __rec_cleanup(WT_SESSION_IMPL *session, WT_RECONCILE *r)
     /* Reconciliation is not re-entrant, make sure that doesn't happen. */
     r->ref = NULL;
 
-    return (0);
+    return (ret);
 }
 
 /*
@@ -825,6 +830,8 @@ __rec_destroy(WT_SESSION_IMPL *session, void *reconcilep)
 
     __wt_free(session, r->supd);
     __wt_free(session, r->delete_hs_upd);
+    __wt_free(session, r->write_jobs);
+    __wt_cond_destroy(session, &r->write_cond);
 
     __wti_rec_dictionary_free(session, r);
 
@@ -920,6 +927,17 @@ __rec_write(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr, size_t *addr_
       session, buf, addr, addr_sizep, compressed_sizep, checkpoint, checkpoint_io, compressed));
 }
 
+/*
+ * __wt_rec_write_job_run --
+ *     Compress, checksum and write a block image handed to the reconciliation write threads.
+ */
+int
+__wt_rec_write_job_run(WT_SESSION_IMPL *session, WT_REC_WRITE_JOB *job)
+{
+    return (__rec_write(session, &job->image, job->addr, &job->addr_size, &job->compressed_size,
+      false, false, false));
+}
+
 /*
  * __rec_leaf_page_max_slvg --
  *     Figure out the maximum leaf page size for a salvage reconciliation.
@@ -1731,11 +1749,11 @@ __rec_split_finish_process_prev(WT_SESSION_IMPL *session, WT_RECONCILE *r)
 }
 
 /*
- * __wti_rec_split_finish --
+ * __rec_split_finish --
  *     Finish processing a page.
  */
-int
-__wti_rec_split_finish(WT_SESSION_IMPL *session, WT_RECONCILE *r)
+static int
+__rec_split_finish(WT_SESSION_IMPL *session, WT_RECONCILE *r)
 {
     /*
      * We're done reconciling, write the final page. We may arrive here with no entries to write if
@@ -1787,6 +1805,25 @@ __wti_rec_split_finish(WT_SESSION_IMPL *session, WT_RECONCILE *r)
     return (__rec_split_write(session, r, r->cur_ptr, NULL, true));
 }
 
+/*
+ * __wti_rec_split_finish --
+ *     Finish processing a page, and collect the blocks written by the write threads.
+ */
+int
+__wti_rec_split_finish(WT_SESSION_IMPL *session, WT_RECONCILE *r)
+{
+    WT_DECL_RET;
+
+    ret = __rec_split_finish(session, r);
+
+    /*
+     * The parent page update needs the addresses of all the blocks, collect them even on error so
+     * the blocks already written can be discarded.
+     */
+    WT_TRET(__rec_split_write_collect(session, r));
+    return (ret);
+}
+
 /*
  * __rec_supd_move --
  *     Move a saved WT_UPDATE list from the per-page cache to a specific block's list.
@@ -2042,6 +2079,122 @@ __rec_compression_adjust(WT_SESSION_IMPL *session, uint32_t max, size_t compress
     WT_WRITE_ONCE(*adjustp, new);
 }
 
+/*
+ * __rec_split_write_compadjust --
+ *     Adjust the pre-compression page size based on compression results.
+ */
+static void
+__rec_split_write_compadjust(
+  WT_SESSION_IMPL *session, WT_RECONCILE *r, size_t compressed_size, bool last_block)
+{
+    WT_BTREE *btree;
+
+    btree = S2BT(session);
+
+    if (WT_PAGE_IS_INTERNAL(r->page) && compressed_size != 0 && btree->intlpage_compadjust)
+        __rec_compression_adjust(
+          session, btree->maxintlpage, compressed_size, last_block, &btree->maxintlpage_precomp);
+    if (!WT_PAGE_IS_INTERNAL(r->page) && compressed_size != 0 && btree->leafpage_compadjust)
+        __rec_compression_adjust(
+          session, btree->maxleafpage, compressed_size, last_block, &btree->maxleafpage_precomp);
+}
+
+/*
+ * __rec_split_write_queue --
+ *     Hand a copy of a block image to the reconciliation write threads, unless they've stopped.
+ */
+static int
+__rec_split_write_queue(
+  WT_SESSION_IMPL *session, WT_RECONCILE *r, WTI_REC_CHUNK *chunk, bool *queuedp)
+{
+    WT_DECL_RET;
+    WT_REC_WRITE_JOB *job;
+
+    *queuedp = false;
+
+    if (r->write_cond == NULL)
+        WT_RET(__wt_cond_alloc(session, "reconcile write", &r->write_cond));
+    WT_RET(__wt_realloc_def(
+      session, &r->write_jobs_allocated, r->write_jobs_next + 1, &r->write_jobs));
+
+    /*
+     * The chunk's buffer is reused for the next block, copy the image. The block manager pads the
+     * image to its allocation size in place, keep the chunk's buffer size.
+     */
+    WT_RET(__wt_calloc_one(session, &job));
+    job->r = r;
+    job->dhandle = session->dhandle;
+    job->multi_slot = r->multi_next - 1;
+    WT_ERR(__wt_buf_init(session, &job->image, chunk->image.memsize));
+    memcpy(job->image.mem, chunk->image.data, chunk->image.size);
+    job->image.size = chunk->image.size;
+
+    if (__wt_conn_rec_write_queue_push(session, job)) {
+        r->write_jobs[r->write_jobs_next++] = job;
+        *queuedp = true;
+        return (0);
+    }
+
+err:
+    __wt_buf_free(session, &job->image);
+    __wt_free(session, job);
+    return (ret);
+}
+
+/*
+ * __rec_split_write_collect --
+ *     Wait for the blocks handed to the write threads and gather their addresses into the list of
+ *     blocks written.
+ */
+static int
+__rec_split_write_collect(WT_SESSION_IMPL *session, WT_RECONCILE *r)
+{
+    WT_DECL_RET;
+    WT_MULTI *multi;
+    WT_REC_WRITE_JOB *job;
+    uint32_t i;
+    bool waited;
+
+    if (r->write_jobs_next == 0)
+        return (0);
+
+    /*
+     * Write any blocks no write thread has claimed yet rather than waiting for a thread to become
+     * available, then wait for the writes already in progress.
+     */
+    for (i = 0; i < r->write_jobs_next; ++i) {
+        job = r->write_jobs[i];
+        if (__wt_conn_rec_write_queue_remove(session, job)) {
+            job->ret = __wt_rec_write_job_run(session, job);
+            WT_STAT_CONN_INCR(session, rec_write_inline);
+        }
+    }
+    for (waited = false; __wt_conn_rec_write_pending(session, r) != 0; waited = true)
+        __wt_cond_wait(session, r->write_cond, 10 * WT_THOUSAND, NULL);
+    if (waited)
+        WT_STAT_CONN_INCR(session, rec_write_wait);
+
+    for (i = 0; i < r->write_jobs_next; ++i) {
+        job = r->write_jobs[i];
+        multi = &r->multi[job->multi_slot];
+        if (job->ret == 0) {
+            if ((job->ret = __wt_memdup(session, job->addr, job->addr_size, &multi->addr.addr)) ==
+              0) {
+                multi->addr.size = (uint8_t)job->addr_size;
+                __rec_split_write_compadjust(session, r, job->compressed_size, false);
+            } else
+                WT_TRET(__wt_btree_block_free(session, job->addr, job->addr_size));
+        }
+        WT_TRET(job->ret);
+
+        __wt_buf_free(session, &job->image);
+        __wt_free(session, job);
+    }
+    r->write_jobs_next = 0;
+
+    return (ret);
+}
+
 /*
  * __rec_split_write --
  *     Write a disk block out for the split helper functions.
@@ -2055,6 +2208,7 @@ __rec_split_write(WT_SESSION_IMPL *session, WT_RECONCILE *r, WTI_REC_CHUNK *chun
     WT_PAGE *page;
     size_t addr_size, compressed_size;
     uint8_t addr[WT_ADDR_MAX_COOKIE];
+    bool queued;
 #ifdef HAVE_DIAGNOSTIC
     bool verify_image;
 #endif
@@ -2162,6 +2316,24 @@ __rec_split_write(WT_SESSION_IMPL *session, WT_RECONCILE *r, WTI_REC_CHUNK *chun
         WT_ASSERT_ALWAYS(session, chunk->entries > 0, "Trying to write an empty chunk");
     }
 
+    /*
+     * If the write threads are running, hand all but the last block of an eviction to them: the
+     * evicting thread keeps building the next block while earlier ones are compressed, checksummed
+     * and written. The last block is written here, the addresses of the queued blocks are
+     * collected before the parent page is updated.
+     */
+    if (!last_block && compressed_image == NULL && F_ISSET(r, WT_REC_EVICT) &&
+      !F_ISSET(r, WT_REC_CHECKPOINT) && F_ISSET(S2C(session), WT_CONN_REC_WRITE_RUN)) {
+        WT_RET(__rec_split_write_queue(session, r, chunk, &queued));
+        if (queued) {
+#ifdef HAVE_DIAGNOSTIC
+            verify_image = false;
+#endif
+            __rec_page_time_stats(session, r);
+            goto copy_image;
+        }
+    }
+
     /* Write the disk image and get an address. */
     WT_RET(__rec_write(session, compressed_image == NULL ? &chunk->image : compressed_image, addr,
       &addr_size, &compressed_size, false, F_ISSET(r, WT_REC_CHECKPOINT),
@@ -2173,12 +2345,7 @@ __rec_split_write(WT_SESSION_IMPL *session, WT_RECONCILE *r, WTI_REC_CHUNK *chun
     multi->addr.size = (uint8_t)addr_size;
 
     /* Adjust the pre-compression page size based on compression results. */
-    if (WT_PAGE_IS_INTERNAL(page) && compressed_size != 0 && btree->intlpage_compadjust)
-        __rec_compression_adjust(
-          session, btree->maxintlpage, compressed_size, last_block, &btree->maxintlpage_precomp);
-    if (!WT_PAGE_IS_INTERNAL(page) && compressed_size != 0 && btree->leafpage_compadjust)
-        __rec_compression_adjust(
-          session, btree->maxleafpage, compressed_size, last_block, &btree->maxleafpage_precomp);
+    __rec_split_write_compadjust(session, r, compressed_size, last_block);
 
     /* Update the per-page reconciliation time statistics now that we've written something. */
     __rec_page_time_stats(session, r);
@@ -2295,6 +2462,156 @@ err:
     return (ret);
 }
 
+/*
+ * __wt_bulk_run_init --
+ *     Initialize reconciliation of a parallel bulk-load run into a private leaf page, using the
+ *     supplied key as the run's first page key.
+ */
+int
+__wt_bulk_run_init(WT_SESSION_IMPL *session, WT_CURSOR_BULK *leader, WT_CURSOR_BULK *cbulk,
+  const void *key, size_t size)
+{
+    WT_BTREE *btree;
+    WT_DECL_RET;
+    WT_IKEY *ikey;
+    WT_PAGE *page;
+    WT_RECONCILE *r;
+    WT_REF *ref;
+
+    btree = S2BT(session);
+    ikey = NULL;
+    page = NULL;
+    ref = NULL;
+
+    /*
+     * The run's leaf page is never linked into the tree: it shares the parent of the bulk cursor's
+     * leaf page so the reconciliation code can find the run's first key, and the pages written for
+     * it are merged into the bulk cursor's leaf page when the load completes.
+     */
+    WT_ERR(__wt_calloc_one(session, &ref));
+    WT_ERR(__wt_row_ikey_alloc(session, 0, key, size, &ikey));
+    ref->home = leader->ref->home;
+    ref->ref_ikey = ikey;
+    ikey = NULL;
+    F_SET(ref, WT_REF_FLAG_LEAF);
+
+    WT_ERR(__wt_page_alloc(session, WT_PAGE_ROW_LEAF, 0, false, &page));
+    WT_ERR(__wt_page_modify_init(session, page));
+    ref->page = page;
+    page = NULL;
+
+    cbulk->ref = ref;
+    cbulk->leaf = ref->page;
+    ref = NULL;
+
+    WT_ERR(__rec_init(session, cbulk->ref, 0, NULL, &cbulk->reconcile));
+    r = cbulk->reconcile;
+    r->is_bulk_load = true;
+
+    return (
+      __wti_rec_split_init(session, r, cbulk->leaf, WT_RECNO_OOB, btree->maxleafpage_precomp, 0));
+
+err:
+    __wt_free(session, ikey);
+    if (page != NULL)
+        __wt_page_out(session, &page);
+    __wt_free(session, ref);
+    return (ret);
+}
+
+/*
+ * __wt_bulk_run_finish --
+ *     Write the last page of a parallel bulk-load run and hand the run's list of written pages to
+ *     the caller.
+ */
+int
+__wt_bulk_run_finish(
+  WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk, WT_MULTI **multip, uint32_t *entriesp)
+{
+    WT_RECONCILE *r;
+
+    r = cbulk->reconcile;
+
+    WT_RET(__wti_rec_split_finish(session, r));
+
+    *multip = r->multi;
+    *entriesp = r->multi_next;
+    r->multi = NULL;
+    r->multi_next = 0;
+    r->multi_allocated = 0;
+    return (0);
+}
+
+/*
+ * __wt_bulk_run_discard --
+ *     Discard a parallel bulk-load run's reconciliation state and private leaf page.
+ */
+int
+__wt_bulk_run_discard(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk)
+{
+    WT_DECL_RET;
+    WT_PAGE *page;
+    WT_REF *ref;
+
+    if ((ref = cbulk->ref) == NULL)
+        return (0);
+
+    if (cbulk->reconcile != NULL) {
+        WT_TRET(__rec_cleanup(session, cbulk->reconcile));
+        WT_TRET(__rec_destroy(session, &cbulk->reconcile));
+    }
+
+    /*
+     * The page was never marked dirty (it isn't in the tree and nothing was counted against the
+     * cache's dirty bytes), clear the state set by reconciliation initialization and discard it.
+     */
+    page = ref->page;
+    page->modify->flags = 0;
+    __wt_atomic_store32(&page->modify->page_state, WT_PAGE_CLEAN);
+    __wt_page_out(session, &page);
+
+    __wt_free(session, ref->ref_ikey);
+    __wt_free(session, ref);
+    cbulk->ref = NULL;
+    cbulk->leaf = NULL;
+    return (ret);
+}
+
+/*
+ * __wt_bulk_run_merge --
+ *     Append the pages written for a parallel bulk-load run to the bulk cursor's list of written
+ *     pages, taking ownership of them.
+ */
+int
+__wt_bulk_run_merge(
+  WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk, WT_MULTI **multip, uint32_t *entriesp)
+{
+    WT_DECL_RET;
+    WT_MULTI *multi;
+    WT_RECONCILE *r;
+    uint32_t i;
+
+    r = cbulk->reconcile;
+    if (*entriesp == 0)
+        return (0);
+
+    if ((ret = __wt_realloc_def(
+           session, &r->multi_allocated, r->multi_next + *entriesp, &r->multi)) == 0) {
+        memcpy(&r->multi[r->multi_next], *multip, *entriesp * sizeof(WT_MULTI));
+        r->multi_next += *entriesp;
+    } else
+        for (multi = *multip, i = 0; i < *entriesp; ++multi, ++i) {
+            __wt_free(session, multi->key.ikey);
+            __wt_free(session, multi->disk_image);
+            __wt_free(session, multi->supd);
+            __wt_free(session, multi->addr.addr);
+        }
+
+    __wt_free(session, *multip);
+    *entriesp = 0;
+    return (ret);
+}
+
 /*
  * __rec_split_discard --
  *     Discard the pages resulting from a previous split.
@@ -2659,6 +2976,9 @@ __rec_write_err(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_PAGE *page)
     WT_MULTI *multi;
     uint32_t i;
 
+    /* Wait for any blocks still with the write threads, so their addresses are known. */
+    WT_TRET(__rec_split_write_collect(session, r));
+
     /*
      * On error, discard blocks we've written, they're unreferenced by the tree. This is not a
      * question of correctness, we're avoiding block leaks.
@@ -35,6 +35,26 @@ struct __wt_delete_hs_upd {
     WT_UPDATE *tombstone;
 };
 
+/*
+ * WT_REC_WRITE_JOB --
+ *	A block image queued for the reconciliation write threads to compress, checksum and write.
+ */
+struct __wt_rec_write_job {
+    WT_RECONCILE *r;         /* Owning reconciliation */
+    WT_DATA_HANDLE *dhandle; /* Tree being reconciled */
+    uint32_t multi_slot;     /* Block's slot in the reconciliation's list */
+
+    WT_ITEM image; /* Private copy of the disk image */
+
+    uint8_t addr[WT_ADDR_MAX_COOKIE]; /* Results */
+    size_t addr_size;
+    size_t compressed_size;
+    int ret;
+
+    bool queued; /* Locked: rec_write_lock */
+    TAILQ_ENTRY(__wt_rec_write_job) q;
+};
+
 /*
  * Reconciliation is the process of taking an in-memory page, walking each entry
  * in the page, building a backing disk image in a temporary buffer representing
@@ -212,6 +232,16 @@ struct __wt_reconcile {
     uint32_t multi_next;
     size_t multi_allocated;
 
+    /*
+     * Blocks handed to the reconciliation write threads. The addresses are collected into the list
+     * of pages written before the reconciliation wraps up.
+     */
+    WT_REC_WRITE_JOB **write_jobs;
+    uint32_t write_jobs_next;
+    size_t write_jobs_allocated;
+    wt_shared uint32_t write_jobs_pending; /* Locked: rec_write_lock */
+    WT_CONDVAR *write_cond;
+
     /*
      * Root pages are written when wrapping up the reconciliation, remember the image we're going to
      * write.
@@ -291,10 +321,21 @@ extern int __wt_bulk_insert_row(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wt_bulk_insert_var(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk, bool deleted)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+extern int __wt_bulk_run_discard(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk)
+  WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+extern int __wt_bulk_run_finish(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk, WT_MULTI **multip,
+  uint32_t *entriesp) WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+extern int __wt_bulk_run_init(WT_SESSION_IMPL *session, WT_CURSOR_BULK *leader,
+  WT_CURSOR_BULK *cbulk, const void *key, size_t size)
+  WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+extern int __wt_bulk_run_merge(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk, WT_MULTI **multip,
+  uint32_t *entriesp) WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wt_bulk_wrapup(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wt_ovfl_discard_add(WT_SESSION_IMPL *session, WT_PAGE *page, WT_CELL *cell)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+extern int __wt_rec_write_job_run(WT_SESSION_IMPL *session, WT_REC_WRITE_JOB *job)
+  WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wt_reconcile(WT_SESSION_IMPL *session, WT_REF *ref, WT_SALVAGE_COOKIE *salvage,
   uint32_t flags) WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern uint32_t __wt_split_page_size(int split_pct, uint32_t maxpagesize, uint32_t allocsize)
@@ -161,6 +161,40 @@ __rts_thread_destroy(WT_SESSION_IMPL *session)
     return (ret);
 }
 
+/*
+ * Progress of rollback to stable over the files read into the startup metadata cache.
+ */
+typedef struct {
+    WT_TIMER timer;
+    uint64_t max_count, rollback_count, rollback_msg_count;
+    wt_timestamp_t rollback_timestamp;
+} WT_RTS_APPLY_CACHED;
+
+/*
+ * __rts_btree_apply_cached --
+ *     Perform rollback to stable on a file read into the startup metadata cache.
+ */
+static int
+__rts_btree_apply_cached(WT_SESSION_IMPL *session, const char *uri, const char *config,
+  const WT_CKPT *ckpt, void *cookie)
+{
+    WT_DECL_RET;
+    WT_RTS_APPLY_CACHED *apply;
+
+    WT_UNUSED(ckpt);
+    apply = (WT_RTS_APPLY_CACHED *)cookie;
+
+    /* Log a progress message. */
+    ++apply->rollback_count;
+    __wti_rts_progress_msg(session, &apply->timer, apply->rollback_count, apply->max_count,
+      &apply->rollback_msg_count, false);
+
+    F_SET(session, WT_SESSION_QUIET_CORRUPT_FILE);
+    ret = __wti_rts_btree_walk_btree_apply(session, uri, config, apply->rollback_timestamp);
+    F_CLR(session, WT_SESSION_QUIET_CORRUPT_FILE);
+    return (ret);
+}
+
 /*
  * __wti_rts_btree_apply_all --
  *     Perform rollback to stable to all files listed in the metadata, apart from the metadata and
@@ -171,54 +205,73 @@ __wti_rts_btree_apply_all(WT_SESSION_IMPL *session, wt_timestamp_t rollback_time
 {
     WT_CURSOR *cursor;
     WT_DECL_RET;
+    WT_RTS_APPLY_CACHED apply;
     WT_RTS_WORK_UNIT *entry;
     WT_TIMER timer;
     uint64_t max_count, rollback_count, rollback_msg_count;
     char ts_string[WT_TS_INT_STRING_SIZE];
     const char *config, *uri;
-    bool have_cursor, rts_threads_started;
+    bool cached, have_cursor, rts_threads_started;
 
     __wt_timer_start(session, &timer);
     max_count = rollback_count = 0;
     rollback_msg_count = 0;
-    rts_threads_started = false;
+    have_cursor = rts_threads_started = false;
+
+    /*
+     * At startup, the files' metadata was read into the startup cache: it already knows how many
+     * files we have overall, and we don't need to walk the metadata again.
+     */
+    cached = S2C(session)->meta_ckpt_cache.entries != NULL;
 
     /*
      * Walk the metadata first to count how many files we have overall. That allows us to give
      * signal about progress.
      */
-    WT_RET(__wt_metadata_cursor(session, &cursor));
-    have_cursor = true;
-    while ((ret = cursor->next(cursor)) == 0) {
-        WT_ERR(cursor->get_key(cursor, &uri));
-        if (WT_BTREE_PREFIX(uri))
-            ++max_count;
+    if (cached)
+        max_count = S2C(session)->meta_ckpt_cache.entries_next;
+    else {
+        WT_ERR(__wt_metadata_cursor(session, &cursor));
+        have_cursor = true;
+        while ((ret = cursor->next(cursor)) == 0) {
+            WT_ERR(cursor->get_key(cursor, &uri));
+            if (WT_BTREE_PREFIX(uri))
+                ++max_count;
+        }
+        WT_ERR_NOTFOUND_OK(ret, false);
+        WT_ERR(__wt_metadata_cursor_release(session, &cursor));
+        have_cursor = false;
     }
-    WT_ERR_NOTFOUND_OK(ret, false);
-    WT_ERR(__wt_metadata_cursor_release(session, &cursor));
-    have_cursor = false;
 
     WT_ERR(__rts_thread_create(session));
     rts_threads_started = true;
 
-    WT_ERR(__wt_metadata_cursor(session, &cursor));
-    have_cursor = true;
-    while ((ret = cursor->next(cursor)) == 0) {
-        /* Log a progress message. */
-        WT_ERR(cursor->get_key(cursor, &uri));
-        WT_ERR(cursor->get_value(cursor, &config));
-        if (WT_BTREE_PREFIX(uri))
-            ++rollback_count;
-        __wti_rts_progress_msg(
-          session, &timer, rollback_count, max_count, &rollback_msg_count, false);
-
-        F_SET(session, WT_SESSION_QUIET_CORRUPT_FILE);
-        ret = __wti_rts_btree_walk_btree_apply(session, uri, config, rollback_timestamp);
-        F_CLR(session, WT_SESSION_QUIET_CORRUPT_FILE);
+    if (cached) {
+        WT_CLEAR(apply);
+        apply.timer = timer;
+        apply.max_count = max_count;
+        apply.rollback_timestamp = rollback_timestamp;
+        WT_ERR(__wt_meta_ckpt_cache_apply(session, NULL, __rts_btree_apply_cached, &apply));
+    } else {
+        WT_ERR(__wt_metadata_cursor(session, &cursor));
+        have_cursor = true;
+        while ((ret = cursor->next(cursor)) == 0) {
+            /* Log a progress message. */
+            WT_ERR(cursor->get_key(cursor, &uri));
+            WT_ERR(cursor->get_value(cursor, &config));
+            if (WT_BTREE_PREFIX(uri))
+                ++rollback_count;
+            __wti_rts_progress_msg(
+              session, &timer, rollback_count, max_count, &rollback_msg_count, false);
+
+            F_SET(session, WT_SESSION_QUIET_CORRUPT_FILE);
+            ret = __wti_rts_btree_walk_btree_apply(session, uri, config, rollback_timestamp);
+            F_CLR(session, WT_SESSION_QUIET_CORRUPT_FILE);
 
-        WT_ERR(ret);
+            WT_ERR(ret);
+        }
+        WT_ERR_NOTFOUND_OK(ret, false);
     }
-    WT_ERR_NOTFOUND_OK(ret, false);
 
     /*
      * Wait until the entire RTS queue is finished processing before performing the history store
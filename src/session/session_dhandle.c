@@ -839,14 +839,21 @@ __wt_session_dhandle_sweep(WT_SESSION_IMPL *session)
 
 /*
  * __session_find_shared_dhandle --
- *     Search for a data handle in the connection and add it to a session's cache. We must increment
- *     the handle's reference count while holding the handle list lock.
+ *     Search for a data handle in the connection and add it to a session's cache. The lock-free
+ *     search increments the handle's reference count itself, otherwise we must increment it while
+ *     holding the handle list lock.
  */
 static int
 __session_find_shared_dhandle(WT_SESSION_IMPL *session, const char *uri, const char *checkpoint)
 {
     WT_DECL_RET;
 
+    /* Most searches find an existing handle, try without the handle list lock first. */
+    if (__wt_conn_dhandle_find_nolock(session, uri, checkpoint) == 0) {
+        WT_STAT_CONN_INCR(session, dh_conn_find_nolock);
+        return (0);
+    }
+
     WT_WITH_HANDLE_LIST_READ_LOCK(session,
       if ((ret = __wt_conn_dhandle_find(session, uri, checkpoint)) == 0)
         WT_DHANDLE_ACQUIRE(session->dhandle));
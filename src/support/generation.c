@@ -28,6 +28,8 @@ __gen_name(int which)
     switch (which) {
     case WT_GEN_CHECKPOINT:
         return ("checkpoint");
+    case WT_GEN_DHANDLE:
+        return ("data handle");
     case WT_GEN_EVICT:
         return ("evict");
     case WT_GEN_HAS_SNAPSHOT:
@@ -189,6 +189,7 @@ static const char *const __stats_dsrc_desc[] = {
   "cursor: Total number of times cursor temporarily releases pinned page to encourage eviction of "
   "hot or large page",
   "cursor: bulk loaded cursor insert calls",
+  "cursor: bulk-load runs built in parallel",
   "cursor: cache cursors reuse count",
   "cursor: close calls that result in cache",
   "cursor: create calls",
@@ -521,6 +522,7 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->cursor_reposition_failed = 0;
     stats->cursor_reposition = 0;
     stats->cursor_insert_bulk = 0;
+    stats->cursor_bulk_runs = 0;
     stats->cursor_reopen = 0;
     stats->cursor_cache = 0;
     stats->cursor_create = 0;
@@ -843,6 +845,7 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->cursor_reposition_failed += from->cursor_reposition_failed;
     to->cursor_reposition += from->cursor_reposition;
     to->cursor_insert_bulk += from->cursor_insert_bulk;
+    to->cursor_bulk_runs += from->cursor_bulk_runs;
     to->cursor_reopen += from->cursor_reopen;
     to->cursor_cache += from->cursor_cache;
     to->cursor_create += from->cursor_create;
@@ -1187,6 +1190,7 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
     to->cursor_reposition_failed += WT_STAT_DSRC_READ(from, cursor_reposition_failed);
     to->cursor_reposition += WT_STAT_DSRC_READ(from, cursor_reposition);
     to->cursor_insert_bulk += WT_STAT_DSRC_READ(from, cursor_insert_bulk);
+    to->cursor_bulk_runs += WT_STAT_DSRC_READ(from, cursor_bulk_runs);
     to->cursor_reopen += WT_STAT_DSRC_READ(from, cursor_reopen);
     to->cursor_cache += WT_STAT_DSRC_READ(from, cursor_cache);
     to->cursor_create += WT_STAT_DSRC_READ(from, cursor_create);
@@ -1377,6 +1381,7 @@ static const char *const __stats_connection_desc[] = {
   "block-manager: number of times the file was remapped because it changed size via fallocate or "
   "truncate",
   "block-manager: number of times the region was remapped via write",
+  "block-manager: tree pre-loads skipped during recovery",
   "cache: application thread time evicting (usecs)",
   "cache: application threads page read from disk to cache count",
   "cache: application threads page read from disk to cache time (usecs)",
@@ -1669,6 +1674,8 @@ static const char *const __stats_connection_desc[] = {
   "connection: memory allocations",
   "connection: memory frees",
   "connection: memory re-allocations",
+  "connection: metadata checkpoint lookups served from the startup checkpoint cache",
+  "connection: metadata entries read into the startup checkpoint cache",
   "connection: number of sessions without a sweep for 5+ minutes",
   "connection: number of sessions without a sweep for 60+ minutes",
   "connection: pthread mutex condition wait calls",
@@ -1700,6 +1707,7 @@ static const char *const __stats_connection_desc[] = {
   "cursor: cursor bounds search early exit",
   "cursor: cursor bounds search near call repositioned cursor",
   "cursor: cursor bulk loaded cursor insert calls",
+  "cursor: cursor bulk-load runs built in parallel",
   "cursor: cursor cache calls that return an error",
   "cursor: cursor close calls that result in cache",
   "cursor: cursor close calls that return an error",
@@ -1762,8 +1770,10 @@ static const char *const __stats_connection_desc[] = {
   "data-handle: checkpoint connection data handles currently active",
   "data-handle: connection data handle size",
   "data-handle: connection data handles currently active",
+  "data-handle: connection data handles found without the handle list lock",
   "data-handle: connection sweep candidate became referenced",
   "data-handle: connection sweep dead dhandles closed",
+  "data-handle: connection sweep dhandles examined",
   "data-handle: connection sweep dhandles removed from hash list",
   "data-handle: connection sweep expired dhandles closed",
   "data-handle: connection sweep time-of-death sets",
@@ -1891,6 +1901,8 @@ static const char *const __stats_connection_desc[] = {
   "reconciliation: VLCS pages explicitly reconciled as empty",
   "reconciliation: approximate byte size of timestamps in pages written",
   "reconciliation: approximate byte size of transaction IDs in pages written",
+  "reconciliation: blocks queued for the write threads",
+  "reconciliation: blocks queued for the write threads written by the reconciling thread",
   "reconciliation: fast-path pages deleted",
   "reconciliation: leaf-page overflow keys",
   "reconciliation: maximum milliseconds spent in a reconciliation call",
@@ -1919,6 +1931,7 @@ static const char *const __stats_connection_desc[] = {
   "reconciliation: pages written including at least one stop durable timestamp",
   "reconciliation: pages written including at least one stop timestamp",
   "reconciliation: pages written including at least one stop transaction ID",
+  "reconciliation: reconciliation calls that waited for the write threads",
   "reconciliation: records written including a prepare state",
   "reconciliation: records written including a start durable timestamp",
   "reconciliation: records written including a start timestamp",
@@ -2152,6 +2165,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->block_byte_map_read = 0;
     stats->block_remap_file_resize = 0;
     stats->block_remap_file_write = 0;
+    stats->block_preload_skipped = 0;
     stats->eviction_app_time = 0;
     stats->cache_read_app_count = 0;
     stats->cache_read_app_time = 0;
@@ -2426,6 +2440,8 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->memory_allocation = 0;
     stats->memory_free = 0;
     stats->memory_grow = 0;
+    stats->meta_ckpt_cache_hit = 0;
+    stats->meta_ckpt_cache_entries = 0;
     stats->no_session_sweep_5min = 0;
     stats->no_session_sweep_60min = 0;
     stats->cond_wait = 0;
@@ -2455,6 +2471,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cursor_bounds_search_early_exit = 0;
     stats->cursor_bounds_search_near_repositioned_cursor = 0;
     stats->cursor_insert_bulk = 0;
+    stats->cursor_bulk_runs = 0;
     stats->cursor_cache_error = 0;
     stats->cursor_cache = 0;
     stats->cursor_close_error = 0;
@@ -2517,8 +2534,10 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing dh_conn_handle_checkpoint_count */
     /* not clearing dh_conn_handle_size */
     /* not clearing dh_conn_handle_count */
+    stats->dh_conn_find_nolock = 0;
     stats->dh_sweep_ref = 0;
     stats->dh_sweep_dead_close = 0;
+    stats->dh_sweep_examined = 0;
     stats->dh_sweep_remove = 0;
     stats->dh_sweep_expired_close = 0;
     stats->dh_sweep_tod = 0;
@@ -2646,6 +2665,8 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->rec_vlcs_emptied_pages = 0;
     stats->rec_time_window_bytes_ts = 0;
     stats->rec_time_window_bytes_txn = 0;
+    stats->rec_write_queued = 0;
+    stats->rec_write_inline = 0;
     stats->rec_page_delete_fast = 0;
     stats->rec_overflow_key_leaf = 0;
     /* not clearing rec_maximum_milliseconds */
@@ -2672,6 +2693,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->rec_time_window_pages_durable_stop_ts = 0;
     stats->rec_time_window_pages_stop_ts = 0;
     stats->rec_time_window_pages_stop_txn = 0;
+    stats->rec_write_wait = 0;
     stats->rec_time_window_prepared = 0;
     stats->rec_time_window_durable_start_ts = 0;
     stats->rec_time_window_start_ts = 0;
@@ -2881,6 +2903,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->block_byte_map_read += WT_STAT_CONN_READ(from, block_byte_map_read);
     to->block_remap_file_resize += WT_STAT_CONN_READ(from, block_remap_file_resize);
     to->block_remap_file_write += WT_STAT_CONN_READ(from, block_remap_file_write);
+    to->block_preload_skipped += WT_STAT_CONN_READ(from, block_preload_skipped);
     to->eviction_app_time += WT_STAT_CONN_READ(from, eviction_app_time);
     to->cache_read_app_count += WT_STAT_CONN_READ(from, cache_read_app_count);
     to->cache_read_app_time += WT_STAT_CONN_READ(from, cache_read_app_time);
@@ -3219,6 +3242,8 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->memory_allocation += WT_STAT_CONN_READ(from, memory_allocation);
     to->memory_free += WT_STAT_CONN_READ(from, memory_free);
     to->memory_grow += WT_STAT_CONN_READ(from, memory_grow);
+    to->meta_ckpt_cache_hit += WT_STAT_CONN_READ(from, meta_ckpt_cache_hit);
+    to->meta_ckpt_cache_entries += WT_STAT_CONN_READ(from, meta_ckpt_cache_entries);
     to->no_session_sweep_5min += WT_STAT_CONN_READ(from, no_session_sweep_5min);
     to->no_session_sweep_60min += WT_STAT_CONN_READ(from, no_session_sweep_60min);
     to->cond_wait += WT_STAT_CONN_READ(from, cond_wait);
@@ -3252,6 +3277,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->cursor_bounds_search_near_repositioned_cursor +=
       WT_STAT_CONN_READ(from, cursor_bounds_search_near_repositioned_cursor);
     to->cursor_insert_bulk += WT_STAT_CONN_READ(from, cursor_insert_bulk);
+    to->cursor_bulk_runs += WT_STAT_CONN_READ(from, cursor_bulk_runs);
     to->cursor_cache_error += WT_STAT_CONN_READ(from, cursor_cache_error);
     to->cursor_cache += WT_STAT_CONN_READ(from, cursor_cache);
     to->cursor_close_error += WT_STAT_CONN_READ(from, cursor_close_error);
@@ -3315,8 +3341,10 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->dh_conn_handle_checkpoint_count += WT_STAT_CONN_READ(from, dh_conn_handle_checkpoint_count);
     to->dh_conn_handle_size += WT_STAT_CONN_READ(from, dh_conn_handle_size);
     to->dh_conn_handle_count += WT_STAT_CONN_READ(from, dh_conn_handle_count);
+    to->dh_conn_find_nolock += WT_STAT_CONN_READ(from, dh_conn_find_nolock);
     to->dh_sweep_ref += WT_STAT_CONN_READ(from, dh_sweep_ref);
     to->dh_sweep_dead_close += WT_STAT_CONN_READ(from, dh_sweep_dead_close);
+    to->dh_sweep_examined += WT_STAT_CONN_READ(from, dh_sweep_examined);
     to->dh_sweep_remove += WT_STAT_CONN_READ(from, dh_sweep_remove);
     to->dh_sweep_expired_close += WT_STAT_CONN_READ(from, dh_sweep_expired_close);
     to->dh_sweep_tod += WT_STAT_CONN_READ(from, dh_sweep_tod);
@@ -3461,6 +3489,8 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->rec_vlcs_emptied_pages += WT_STAT_CONN_READ(from, rec_vlcs_emptied_pages);
     to->rec_time_window_bytes_ts += WT_STAT_CONN_READ(from, rec_time_window_bytes_ts);
     to->rec_time_window_bytes_txn += WT_STAT_CONN_READ(from, rec_time_window_bytes_txn);
+    to->rec_write_queued += WT_STAT_CONN_READ(from, rec_write_queued);
+    to->rec_write_inline += WT_STAT_CONN_READ(from, rec_write_inline);
     to->rec_page_delete_fast += WT_STAT_CONN_READ(from, rec_page_delete_fast);
     to->rec_overflow_key_leaf += WT_STAT_CONN_READ(from, rec_overflow_key_leaf);
     to->rec_maximum_milliseconds += WT_STAT_CONN_READ(from, rec_maximum_milliseconds);
@@ -3493,6 +3523,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
       WT_STAT_CONN_READ(from, rec_time_window_pages_durable_stop_ts);
     to->rec_time_window_pages_stop_ts += WT_STAT_CONN_READ(from, rec_time_window_pages_stop_ts);
     to->rec_time_window_pages_stop_txn += WT_STAT_CONN_READ(from, rec_time_window_pages_stop_txn);
+    to->rec_write_wait += WT_STAT_CONN_READ(from, rec_write_wait);
     to->rec_time_window_prepared += WT_STAT_CONN_READ(from, rec_time_window_prepared);
     to->rec_time_window_durable_start_ts +=
       WT_STAT_CONN_READ(from, rec_time_window_durable_start_ts);
@@ -705,10 +705,10 @@ __recovery_txn_setup_initial_state(WT_SESSION_IMPL *session, WT_RECOVERY *r)
 /*
  * __recovery_setup_file --
  *     Set up the recovery slot for a file, track the largest file ID, and update the base write gen
- *     based on the file's configuration.
+ *     based on the file's configuration, or its last checkpoint if it's already been parsed.
  */
 static int
-__recovery_setup_file(WT_RECOVERY *r, const char *uri, const char *config)
+__recovery_setup_file(WT_RECOVERY *r, const char *uri, const char *config, const WT_CKPT *ckpt)
 {
     WT_CONFIG_ITEM cval;
     WT_DECL_RET;
@@ -757,7 +757,9 @@ __recovery_setup_file(WT_RECOVERY *r, const char *uri, const char *config)
         WT_ASSIGN_LSN(&r->max_ckpt_lsn, &lsn);
 
     /* Update the base write gen and most recent checkpoint based on this file's configuration. */
-    if ((ret = __wt_meta_update_connection(r->session, config)) != 0)
+    if (ckpt != NULL)
+        __wt_meta_update_connection_ckpt(r->session, ckpt);
+    else if ((ret = __wt_meta_update_connection(r->session, config)) != 0)
         WT_ERR_MSG(r->session, ret, "Failed recovery setup for %s: cannot update write gen", uri);
 
 err:
@@ -821,12 +823,28 @@ __recovery_file_scan_prefix(WT_RECOVERY *r, const char *prefix, const char *igno
         if (ignore_suffix != NULL && WT_SUFFIX_MATCH(uri, ignore_suffix))
             continue;
         WT_RET(c->get_value(c, &config));
-        WT_RET(__recovery_setup_file(r, uri, config));
+        WT_RET(__recovery_setup_file(r, uri, config, NULL));
     }
     WT_RET_NOTFOUND_OK(ret);
     return (0);
 }
 
+/*
+ * __recovery_file_scan_cached --
+ *     Gather information for recovery about a file read into the startup metadata cache.
+ */
+static int
+__recovery_file_scan_cached(WT_SESSION_IMPL *session, const char *uri, const char *config,
+  const WT_CKPT *ckpt, void *cookie)
+{
+    WT_UNUSED(session);
+
+    /* As when scanning the metadata, skip tiered objects, they're set up by their tiered entry. */
+    if (WT_PREFIX_MATCH(uri, "file:") && WT_SUFFIX_MATCH(uri, ".wtobj"))
+        return (0);
+    return (__recovery_setup_file((WT_RECOVERY *)cookie, uri, config, ckpt));
+}
+
 /*
  * __recovery_file_scan --
  *     Scan the files referenced from the metadata and gather information about them for recovery.
@@ -834,12 +852,25 @@ __recovery_file_scan_prefix(WT_RECOVERY *r, const char *prefix, const char *igno
 static int
 __recovery_file_scan(WT_RECOVERY *r)
 {
+    WT_DECL_RET;
+
     __wt_verbose_level_multi(r->session, WT_VERB_RECOVERY_ALL, WT_VERBOSE_INFO, "%s",
       "scanning metadata to find the largest file ID");
 
+    /*
+     * The metadata won't change again until recovery is done with it: read the files' entries into
+     * the startup cache, using as many threads as rollback to stable is configured to use. Scan the
+     * files from the cache, rollback to stable and opening the files will use it too.
+     */
+    WT_RET(__wt_meta_ckpt_cache_load(r->session, S2C(r->session)->rts->cfg_threads_num));
+
     /* Scan through all files and tiered entries in the metadata. */
-    WT_RET(__recovery_file_scan_prefix(r, "file:", ".wtobj"));
-    WT_RET(__recovery_file_scan_prefix(r, "tiered:", NULL));
+    WT_RET_NOTFOUND_OK(
+      ret = __wt_meta_ckpt_cache_apply(r->session, NULL, __recovery_file_scan_cached, r));
+    if (ret == WT_NOTFOUND) {
+        WT_RET(__recovery_file_scan_prefix(r, "file:", ".wtobj"));
+        WT_RET(__recovery_file_scan_prefix(r, "tiered:", NULL));
+    }
 
     /*
      * Set the connection level file id tracker, as such upon creation of a new file we'll begin
@@ -960,7 +991,7 @@ __wt_txn_recover(WT_SESSION_IMPL *session, const char *cfg[])
     conn->txn_global.recovery_timestamp = conn->txn_global.meta_ckpt_timestamp = WT_TS_NONE;
 
     WT_ERR(__wt_metadata_search(session, WT_METAFILE_URI, &config));
-    WT_ERR(__recovery_setup_file(&r, WT_METAFILE_URI, config));
+    WT_ERR(__recovery_setup_file(&r, WT_METAFILE_URI, config, NULL));
     WT_ERR(__wt_metadata_cursor_open(session, NULL, &metac));
     metafile = &r.files[WT_METAFILE_ID];
     metafile->c = metac;
@@ -1207,6 +1238,9 @@ done:
           conn->recovery_timeline.rts_ms);
     }
 
+    /* The recovery checkpoint updates the metadata, we're done with the startup cache. */
+    __wt_meta_ckpt_cache_discard(session);
+
     /*
      * Sometimes eviction is triggered after doing a checkpoint. However, we don't want eviction to
      * make the tree dirty after checkpoint as this will interfere with WT_SESSION alter which
@@ -1261,6 +1295,7 @@ done:
 
 err:
     WT_TRET(__recovery_close_cursors(&r));
+    __wt_meta_ckpt_cache_discard(session);
     __wt_free(session, config);
     F_CLR(&conn->log_mgr, WT_LOG_RECOVER_DIRTY);
 
@@ -13,6 +13,7 @@ static int config_read(WT_SESSION *, char ***, bool *);
 static int config_rename(WT_SESSION *, char **, const char *);
 static int format(WT_SESSION *);
 static int insert(WT_CURSOR *, const char *);
+static int insert_sorted(WT_CURSOR *, const char *, bool);
 static int load_dump(WT_SESSION *);
 
 static bool append = false;       /* -a append (ignore number keys) */
@@ -20,6 +21,13 @@ static char *cmdname;             /* -r rename */
 static char **cmdconfig;          /* configuration pairs */
 static bool json = false;         /* -j input is JSON format */
 static bool no_overwrite = false; /* -n don't overwrite existing data */
+static bool sort_input = false;   /* -s sort the input and bulk-load it */
+static uint64_t sort_threads = 0; /* -t bulk-load threads */
+
+/*
+ * The memory used to sort the input before spilling a sorted run to a temporary file.
+ */
+#define LOAD_SORT_MEMORY (64 * WT_MEGABYTE)
 
 /*
  * usage --
@@ -32,11 +40,13 @@ usage(void)
       "ignore record number keys in the input and assign new record number keys", "-f input",
       "read from the specified file (by default records are read from stdin)", "-j",
       "read in JSON format", "-n", "fail at any attempt to overwrite existing data", "-r name",
-      "use the argument as the table name, ignoring any name in the source", "-?",
-      "show this message", NULL, NULL};
+      "use the argument as the table name, ignoring any name in the source", "-s",
+      "sort the input and bulk-load it (the object must not already exist)", "-t threads",
+      "with -s, the number of threads used to build leaf pages", "-?", "show this message", NULL,
+      NULL};
 
-    util_usage(
-      "load [-ajn] [-f input-file] [-r name] [object configuration ...]", "options:", options);
+    util_usage("load [-ajns] [-f input-file] [-r name] [-t threads] [object configuration ...]",
+      "options:", options);
     return (1);
 }
 
@@ -48,13 +58,14 @@ int
 util_load(WT_SESSION *session, int argc, char *argv[])
 {
     uint32_t flags;
+    WT_DECL_RET;
     int ch;
     const char *filename;
 
     flags = 0;
 
     filename = "<stdin>";
-    while ((ch = __wt_getopt(progname, argc, argv, "af:jnr:?")) != EOF)
+    while ((ch = __wt_getopt(progname, argc, argv, "af:jnr:st:?")) != EOF)
         switch (ch) {
         case 'a': /* append (ignore record number keys) */
             append = true;
@@ -74,6 +85,13 @@ util_load(WT_SESSION *session, int argc, char *argv[])
         case 'r': /* rename */
             cmdname = __wt_optarg;
             break;
+        case 's': /* sort the input */
+            sort_input = true;
+            break;
+        case 't': /* bulk-load threads */
+            if ((ret = util_str2num(session, __wt_optarg, true, &sort_threads)) != 0)
+                return (usage());
+            break;
         case '?':
             usage();
             return (0);
@@ -88,6 +106,13 @@ util_load(WT_SESSION *session, int argc, char *argv[])
         return (util_err(
           session, EINVAL, "the -a (append) and -n (no-overwrite) flags are mutually exclusive"));
 
+    /* Sorted input is bulk-loaded: it can't append, check for overwrites or read JSON. */
+    if (sort_input && (append || json || no_overwrite))
+        return (util_err(
+          session, EINVAL, "the -s (sort) flag cannot be combined with the -a, -j or -n flags"));
+    if (sort_threads != 0 && !sort_input)
+        return (util_err(session, EINVAL, "the -t (threads) flag requires the -s (sort) flag"));
+
     /* The remaining arguments are configuration uri/string pairs. */
     if (argc != 0) {
         if (argc % 2 != 0)
@@ -112,6 +137,7 @@ util_load(WT_SESSION *session, int argc, char *argv[])
 static int
 load_dump(WT_SESSION *session)
 {
+    WT_CONFIG_ITEM cval;
     WT_CURSOR *cursor;
     WT_DECL_RET;
     int tret;
@@ -136,13 +162,30 @@ load_dump(WT_SESSION *session)
         goto err;
 
     uri = list[0];
+
+    /* The sort orders keys byte-wise, it can't be used with a custom collator. */
+    if (sort_input &&
+      __wt_config_getones((WT_SESSION_IMPL *)session, list[1], "collator", &cval) == 0 &&
+      cval.len != 0) {
+        fprintf(stderr, "%s: %s: -s option illegal with a custom collator\n", progname, uri);
+        ret = 1;
+        goto err;
+    }
+
     /* Create the items in the list. */
     if ((ret = config_exec(session, list)) != 0)
         goto err;
 
-    /* Open the insert cursor. */
-    if ((ret = __wt_snprintf(config, sizeof(config), "dump=%s%s%s", hex ? "hex" : "print",
-           append ? ",append" : "", no_overwrite ? ",overwrite=false" : "")) != 0) {
+    /*
+     * Open the insert cursor. Sorted input is decoded by the sort and inserted raw, in order,
+     * through a bulk cursor.
+     */
+    if (sort_input)
+        ret = __wt_snprintf(config, sizeof(config), "raw,bulk,bulk_threads=%" PRIu64, sort_threads);
+    else
+        ret = __wt_snprintf(config, sizeof(config), "dump=%s%s%s", hex ? "hex" : "print",
+          append ? ",append" : "", no_overwrite ? ",overwrite=false" : "");
+    if (ret != 0) {
         ret = util_err(session, ret, NULL);
         goto err;
     }
@@ -158,6 +201,13 @@ load_dump(WT_SESSION *session)
         fprintf(stderr, "%s: %s: -a option illegal unless the primary key is a record number\n",
           progname, uri);
         ret = 1;
+    } else if (sort_input) {
+        if (WT_STREQ(cursor->key_format, "r")) {
+            fprintf(stderr, "%s: %s: -s option illegal when the primary key is a record number\n",
+              progname, uri);
+            ret = 1;
+        } else
+            ret = insert_sorted(cursor, uri, hex);
     } else
         ret = insert(cursor, uri);
 
@@ -582,3 +632,276 @@ err:
 
     return (ret);
 }
+
+/*
+ * LOAD_SORT_REC --
+ *     A decoded key/value pair being sorted.
+ */
+typedef struct {
+    uint8_t *data; /* Key bytes followed by value bytes */
+    size_t key_size, value_size;
+    uint64_t seq; /* Input order */
+} LOAD_SORT_REC;
+
+/*
+ * LOAD_SORT_RUN --
+ *     A sorted run spilled to a temporary file, and its current key/value pair while merging.
+ */
+typedef struct {
+    FILE *fp;
+    uint8_t *data; /* Key bytes followed by value bytes */
+    size_t data_size, key_size, value_size;
+    bool eof;
+} LOAD_SORT_RUN;
+
+/*
+ * sort_compare --
+ *     Sort comparison function: key bytes, then input order.
+ */
+static int WT_CDECL
+sort_compare(const void *a_arg, const void *b_arg)
+{
+    const LOAD_SORT_REC *a, *b;
+    int cmp;
+
+    a = a_arg;
+    b = b_arg;
+    if ((cmp = memcmp(a->data, b->data, WT_MIN(a->key_size, b->key_size))) != 0)
+        return (cmp);
+    if (a->key_size != b->key_size)
+        return (a->key_size < b->key_size ? -1 : 1);
+    return (a->seq < b->seq ? -1 : 1);
+}
+
+/*
+ * sort_key_compare --
+ *     Compare the current keys of two runs.
+ */
+static int
+sort_key_compare(LOAD_SORT_RUN *a, LOAD_SORT_RUN *b)
+{
+    int cmp;
+
+    if ((cmp = memcmp(a->data, b->data, WT_MIN(a->key_size, b->key_size))) != 0)
+        return (cmp);
+    return (a->key_size == b->key_size ? 0 : (a->key_size < b->key_size ? -1 : 1));
+}
+
+/*
+ * sort_spill --
+ *     Sort the in-memory pairs and write them to a temporary file as a sorted run. Where a key was
+ *     read more than once, only the last value read is kept, as if each was inserted in turn.
+ */
+static int
+sort_spill(WT_SESSION *session, LOAD_SORT_REC *recs, size_t nrecs, FILE **fpp)
+{
+    FILE *fp;
+    LOAD_SORT_REC *rec;
+    uint64_t sizes[2];
+    size_t i;
+
+    *fpp = NULL;
+    if ((fp = tmpfile()) == NULL)
+        return (util_err(session, errno, "tmpfile"));
+
+    __wt_qsort(recs, nrecs, sizeof(LOAD_SORT_REC), sort_compare);
+    for (i = 0; i < nrecs; ++i) {
+        rec = &recs[i];
+        if (i + 1 < nrecs && rec->key_size == recs[i + 1].key_size &&
+          memcmp(rec->data, recs[i + 1].data, rec->key_size) == 0)
+            continue;
+
+        sizes[0] = rec->key_size;
+        sizes[1] = rec->value_size;
+        if (fwrite(sizes, sizeof(sizes), 1, fp) != 1 ||
+          (rec->key_size + rec->value_size != 0 &&
+            fwrite(rec->data, rec->key_size + rec->value_size, 1, fp) != 1)) {
+            (void)fclose(fp);
+            return (util_err(session, errno, "sorted run: write"));
+        }
+    }
+    if (fflush(fp) != 0 || fseek(fp, 0, SEEK_SET) != 0) {
+        (void)fclose(fp);
+        return (util_err(session, errno, "sorted run: rewind"));
+    }
+    *fpp = fp;
+    return (0);
+}
+
+/*
+ * sort_run_next --
+ *     Read the next key/value pair of a sorted run.
+ */
+static int
+sort_run_next(WT_SESSION *session, LOAD_SORT_RUN *run)
+{
+    uint64_t sizes[2];
+    size_t len;
+
+    if (fread(sizes, sizeof(sizes), 1, run->fp) != 1) {
+        if (ferror(run->fp))
+            return (util_err(session, errno, "sorted run: read"));
+        run->eof = true;
+        return (0);
+    }
+    run->key_size = (size_t)sizes[0];
+    run->value_size = (size_t)sizes[1];
+    len = run->key_size + run->value_size;
+    if (len > run->data_size) {
+        if ((run->data = util_realloc(run->data, len)) == NULL)
+            return (util_err(session, errno, NULL));
+        run->data_size = len;
+    }
+    if (len != 0 && fread(run->data, len, 1, run->fp) != 1)
+        return (util_err(session, errno == 0 ? EIO : errno, "sorted run: read"));
+    return (0);
+}
+
+/*
+ * insert_sorted --
+ *     Read and decode the key/value pairs, sort them in memory-bounded runs spilled to temporary
+ *     files, then merge the runs and insert the pairs in key order.
+ */
+static int
+insert_sorted(WT_CURSOR *cursor, const char *name, bool hex)
+{
+    LOAD_SORT_REC *rec, *recs;
+    LOAD_SORT_RUN *run, *runs, *tmp_run;
+    ULINE key, value;
+    WT_DECL_ITEM(rkey);
+    WT_DECL_ITEM(rvalue);
+    WT_DECL_RET;
+    WT_ITEM item;
+    WT_SESSION *session;
+    WT_SESSION_IMPL *session_impl;
+    size_t i, memory, nrecs, nrecs_alloc, nruns;
+    uint64_t insert_count, seq;
+    bool eof;
+
+    session = cursor->session;
+    session_impl = (WT_SESSION_IMPL *)session;
+
+    memset(&key, 0, sizeof(key));
+    memset(&value, 0, sizeof(value));
+    recs = NULL;
+    runs = NULL;
+    memory = nrecs = nrecs_alloc = nruns = 0;
+
+    WT_ERR(__wt_scr_alloc(session_impl, 0, &rkey));
+    WT_ERR(__wt_scr_alloc(session_impl, 0, &rvalue));
+
+    /* Read and decode the key/value pairs, spilling a sorted run whenever memory fills. */
+    for (seq = 0, eof = false; !eof; ++seq) {
+        WT_ERR(util_read_line(session, &key, true, &eof));
+        if (!eof) {
+            WT_ERR(util_read_line(session, &value, false, &eof));
+            if (hex) {
+                WT_ERR(__wt_hex_to_raw(session_impl, key.mem, rkey));
+                WT_ERR(__wt_hex_to_raw(session_impl, value.mem, rvalue));
+            } else {
+                WT_ERR(__wt_esc_hex_to_raw(session_impl, key.mem, rkey));
+                WT_ERR(__wt_esc_hex_to_raw(session_impl, value.mem, rvalue));
+            }
+
+            if (nrecs == nrecs_alloc) {
+                nrecs_alloc = nrecs_alloc == 0 ? 1024 : nrecs_alloc * 2;
+                if ((recs = util_realloc(recs, nrecs_alloc * sizeof(LOAD_SORT_REC))) == NULL) {
+                    ret = util_err(session, errno, NULL);
+                    goto err;
+                }
+            }
+            rec = &recs[nrecs];
+            if ((rec->data = util_malloc(rkey->size + rvalue->size + 1)) == NULL) {
+                ret = util_err(session, errno, NULL);
+                goto err;
+            }
+            ++nrecs;
+            if (rkey->size != 0)
+                memcpy(rec->data, rkey->data, rkey->size);
+            if (rvalue->size != 0)
+                memcpy(rec->data + rkey->size, rvalue->data, rvalue->size);
+            rec->key_size = rkey->size;
+            rec->value_size = rvalue->size;
+            rec->seq = seq;
+            memory += sizeof(LOAD_SORT_REC) + rkey->size + rvalue->size;
+        }
+
+        if (nrecs != 0 && (eof || memory >= LOAD_SORT_MEMORY)) {
+            if ((runs = util_realloc(runs, (nruns + 1) * sizeof(LOAD_SORT_RUN))) == NULL) {
+                ret = util_err(session, errno, NULL);
+                goto err;
+            }
+            run = &runs[nruns];
+            memset(run, 0, sizeof(*run));
+            ++nruns;
+            WT_ERR(sort_spill(session, recs, nrecs, &run->fp));
+            for (i = 0; i < nrecs; ++i)
+                util_free(recs[i].data);
+            memory = nrecs = 0;
+        }
+    }
+
+    /*
+     * Merge the runs. Where the same key appears in more than one run, the pair from the last run
+     * was read last and wins.
+     */
+    for (i = 0; i < nruns; ++i)
+        WT_ERR(sort_run_next(session, &runs[i]));
+    for (insert_count = 0;;) {
+        run = NULL;
+        for (i = 0; i < nruns; ++i) {
+            tmp_run = &runs[i];
+            if (tmp_run->eof)
+                continue;
+            if (run == NULL || sort_key_compare(tmp_run, run) <= 0)
+                run = tmp_run;
+        }
+        if (run == NULL)
+            break;
+
+        item.data = run->data;
+        item.size = run->key_size;
+        cursor->set_key(cursor, &item);
+        item.data = run->data + run->key_size;
+        item.size = run->value_size;
+        cursor->set_value(cursor, &item);
+        if ((ret = cursor->insert(cursor)) != 0) {
+            ret = util_err(session, ret, "%s: cursor.insert", name);
+            goto err;
+        }
+
+        /* Skip the pairs with the same key in earlier runs. */
+        for (i = 0; i < nruns; ++i) {
+            tmp_run = &runs[i];
+            if (tmp_run != run && !tmp_run->eof && sort_key_compare(tmp_run, run) == 0)
+                WT_ERR(sort_run_next(session, tmp_run));
+        }
+        WT_ERR(sort_run_next(session, run));
+
+        /* Report on progress every 100 inserts. */
+        if (verbose && ++insert_count % 100 == 0) {
+            printf("\r\t%s: %" PRIu64, name, insert_count);
+            fflush(stdout);
+        }
+    }
+
+    if (verbose)
+        printf("\r\t%s: %" PRIu64 "\n", name, insert_count);
+
+err:
+    for (i = 0; i < nrecs; ++i)
+        util_free(recs[i].data);
+    util_free(recs);
+    for (i = 0; i < nruns; ++i) {
+        if (runs[i].fp != NULL)
+            (void)fclose(runs[i].fp);
+        util_free(runs[i].data);
+    }
+    util_free(runs);
+    __wt_scr_free(session_impl, &rkey);
+    __wt_scr_free(session_impl, &rvalue);
+    util_free(key.mem);
+    util_free(value.mem);
+
+    return (ret);
+}
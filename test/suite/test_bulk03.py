@@ -0,0 +1,157 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+#
+# test_bulk03.py
+#       Parallel bulk-load testing.
+
+import random
+import wiredtiger, wttest
+from suite_subprocess import suite_subprocess
+from wtdataset import simple_key, simple_value
+from wtscenario import make_scenarios
+
+# test_bulk03_parallel
+#       Test row-store bulk-load with the leaf pages built by worker threads.
+class test_bulk03_parallel(wttest.WiredTigerTestCase):
+    nentries = 20000
+    types = [
+        ('file', dict(uri='file:data')),
+        ('table', dict(uri='table:data')),
+    ]
+    threads = [
+        ('threads-1', dict(threads=1)),
+        ('threads-4', dict(threads=4)),
+    ]
+    scenarios = make_scenarios(types, threads)
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def test_bulk_parallel(self):
+        # Small leaf pages so the load is split into many runs.
+        self.session.create(self.uri, 'key_format=S,value_format=S,leaf_page_max=512')
+        cursor = self.session.open_cursor(
+            self.uri, None, 'bulk,bulk_threads={}'.format(self.threads))
+        for i in range(1, self.nentries + 1):
+            cursor[simple_key(cursor, i)] = simple_value(cursor, i)
+        cursor.close()
+        self.assertGreater(self.get_stat(wiredtiger.stat.conn.cursor_bulk_runs), 1)
+
+        # Out-of-order keys are still detected.
+        self.session.create('table:misordered', 'key_format=S,value_format=S')
+        cursor = self.session.open_cursor('table:misordered', None, 'bulk,bulk_threads=2')
+        cursor['b'] = 'b'
+        cursor.set_key('a')
+        cursor.set_value('a')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: cursor.insert(), '/out-of-order keys/')
+        cursor.close()
+
+        self.session.checkpoint()
+        self.reopen_conn()
+        self.session.verify(self.uri)
+
+        cursor = self.session.open_cursor(self.uri, None, None)
+        i = 0
+        for key, val in cursor:
+            i += 1
+            self.assertEqual(key, simple_key(cursor, i))
+            self.assertEqual(val, simple_value(cursor, i))
+        self.assertEqual(i, self.nentries)
+        cursor.close()
+
+    # Parallel bulk-load is only supported for row-store objects.
+    def test_bulk_parallel_column(self):
+        self.session.create(self.uri, 'key_format=r,value_format=S')
+        self.assertRaisesException(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor(self.uri, None, 'bulk,bulk_threads=2'))
+
+# test_bulk03_load_sort
+#       Test wt load sorting unsorted input and bulk-loading it.
+class test_bulk03_load_sort(wttest.WiredTigerTestCase, suite_subprocess):
+    nentries = 5000
+    scenarios = make_scenarios([
+        ('print', dict(hex=False)),
+        ('hex', dict(hex=True)),
+    ])
+
+    def test_load_sort(self):
+        uri = 'table:data'
+        self.session.create(uri, 'key_format=S,value_format=S')
+        cursor = self.session.open_cursor(uri, None, None)
+        for i in range(1, self.nentries + 1):
+            cursor[simple_key(cursor, i)] = simple_value(cursor, i)
+        cursor.close()
+
+        self.runWt(['dump'] + (['-x'] if self.hex else []) + ['data'], outfilename='dump.out')
+
+        # Shuffle the key/value pairs following the header, and repeat a key with a new value: the
+        # last value read for a key is the one loaded.
+        with open('dump.out') as f:
+            lines = f.readlines()
+        data = lines.index('Data\n') + 1
+        pairs = [lines[i:i + 2] for i in range(data, len(lines), 2)]
+        random.seed(3)
+        random.shuffle(pairs)
+        pairs.append([pairs[0][0], pairs[1][1]])
+        with open('unsorted.out', 'w') as f:
+            f.writelines(lines[:data])
+            for pair in pairs:
+                f.writelines(pair)
+
+        self.runWt(['load', '-s', '-t', '2', '-f', 'unsorted.out', '-r', 'sorted'])
+
+        self.runWt(['dump'] + (['-x'] if self.hex else []) + ['sorted'], outfilename='sorted.out')
+        with open('sorted.out') as f:
+            sorted_lines = f.readlines()
+        data = sorted_lines.index('Data\n') + 1
+        loaded = dict((sorted_lines[i], sorted_lines[i + 1])
+            for i in range(data, len(sorted_lines), 2))
+        self.assertEqual(len(loaded), self.nentries)
+        self.assertEqual(loaded[pairs[0][0]], pairs[1][1])
+
+        # Apart from the repeated key, the loaded object matches the original.
+        cursor = self.session.open_cursor('table:sorted', None, None)
+        i = 0
+        for key, val in cursor:
+            i += 1
+            self.assertEqual(key, simple_key(cursor, i))
+        self.assertEqual(i, self.nentries)
+        cursor.close()
+
+        # Sorting is incompatible with appending.
+        self.runWt(['load', '-s', '-a', '-f', 'unsorted.out', '-r', 'other'],
+            errfilename='err.out', failure=True)
+        self.check_non_empty_file('err.out')
+
+if __name__ == '__main__':
+    wttest.run()
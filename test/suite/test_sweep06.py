@@ -0,0 +1,112 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+# test_sweep06.py
+#    Test the sweep server only looks at handles that are due: handles in use aren't examined on
+#    every sweep, idle handles are still closed and removed once they've been idle long enough.
+
+import time
+from wiredtiger import stat
+import wttest
+
+class test_sweep06(wttest.WiredTigerTestCase):
+    uri = 'table:test_sweep06'
+    numfiles = 50
+    conn_config = 'file_manager=(close_handle_minimum=0,' + \
+                  'close_idle_time=30,close_scan_interval=1),statistics=(fast)'
+
+    def get_stat(self, s):
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        val = stat_cursor[s][2]
+        stat_cursor.close()
+        return val
+
+    def wait_sweeps(self, count):
+        sweeps1 = self.get_stat(stat.conn.dh_sweeps)
+        sweeps2 = sweeps1
+        sleep = 0
+        while sweeps2 - sweeps1 < count and sleep < 60:
+            time.sleep(1)
+            sleep += 1
+            sweeps2 = self.get_stat(stat.conn.dh_sweeps)
+        self.assertGreaterEqual(sweeps2 - sweeps1, count)
+
+    def test_sweep_busy(self):
+        # FIXME-WT-11367
+        if self.runningHook('tiered'):
+            self.skipTest("this test does not yet work with tiered storage")
+
+        # Keep a cursor open on every table, so none of the handles can become idle.
+        cursors = []
+        for f in range(self.numfiles):
+            uri = '%s.%d' % (self.uri, f)
+            self.session.create(uri, 'key_format=i,value_format=i')
+            c = self.session.open_cursor(uri, None)
+            c[1] = 1
+            cursors.append(c)
+
+        examined1 = self.get_stat(stat.conn.dh_sweep_examined)
+        self.wait_sweeps(5)
+
+        # A sweep of the whole handle list would have looked at every handle in every sweep, the
+        # timing wheel only looks at a handle once it could have become idle.
+        examined2 = self.get_stat(stat.conn.dh_sweep_examined)
+        self.assertLess(examined2 - examined1, self.numfiles)
+
+        # Shorten the idle time and close the cursors: the handles should now be closed and removed.
+        self.conn.reconfigure('file_manager=(close_idle_time=2)')
+        closed1 = self.get_stat(stat.conn.dh_sweep_expired_close)
+        removed1 = self.get_stat(stat.conn.dh_sweep_remove)
+        for c in cursors:
+            c.close()
+
+        removed2 = removed1
+        sleep = 0
+        while removed2 - removed1 < self.numfiles and sleep < 60:
+            time.sleep(1)
+            sleep += 1
+            removed2 = self.get_stat(stat.conn.dh_sweep_remove)
+        closed2 = self.get_stat(stat.conn.dh_sweep_expired_close)
+        self.assertGreaterEqual(closed2 - closed1, self.numfiles)
+        self.assertGreaterEqual(removed2 - removed1, self.numfiles)
+
+        # Let the remaining handles go, then the sweeps have almost nothing to look at.
+        self.wait_sweeps(5)
+        removed3 = self.get_stat(stat.conn.dh_sweep_remove)
+        examined3 = self.get_stat(stat.conn.dh_sweep_examined)
+        self.wait_sweeps(5)
+        examined4 = self.get_stat(stat.conn.dh_sweep_examined)
+        self.assertLess(examined4 - examined3, self.numfiles)
+
+        # Each handle is looked at a few times on its way from idle to removed: the number of
+        # handles examined depends on the number of handles that expired, not on the number of
+        # sweeps times the number of handles.
+        self.assertLessEqual(examined3 - examined2, 5 * (removed3 - removed1) + self.numfiles)
+
+if __name__ == '__main__':
+    wttest.run()